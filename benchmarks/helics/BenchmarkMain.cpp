@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "PholdFederate.hpp"
 #include "RingTransmitFederate.hpp"
 #include "RingTransmitMessageFederate.hpp"
+#include "StartupFederate.hpp"
 #include "TimingHubFederate.hpp"
 #include "TimingLeafFederate.hpp"
 #include "WattsStrogatzFederate.hpp"
@@ -75,6 +76,7 @@ int main(int argc, char* argv[])
                                    "ringtransmitmessage",
                                    "Ring Transmit Message benchmark federate");
 
+        addBM<StartupFederate>(app, "startup", "Startup time benchmark federate");
         addBM<TimingHub>(app, "timinghub", "Timing Hub benchmark federate");
         addBM<TimingLeaf>(app, "timingleaf", "Timing Leaf benchmark federate");
         addBM<WattsStrogatzFederate>(app, "watts-strogatz", "Watts-Strogatz benchmark federate");
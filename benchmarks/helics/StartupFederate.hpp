@@ -0,0 +1,57 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "BenchmarkFederate.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+
+#include <chrono>
+#include <string>
+
+/** class implementing a federate that measures the time taken to connect to a broker and enter
+executing mode,  intended to be launched as many separate processes against a single broker*/
+class StartupFederate: public BenchmarkFederate {
+  private:
+    helics::Publication pub;
+    helics::Input sub;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::nanoseconds startupTime{0};
+
+  public:
+    StartupFederate():
+        BenchmarkFederate("Startup"), startTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    std::string getName() override { return "startup_" + std::to_string(index); }
+
+    void setupArgumentParsing() override
+    {
+        opt_index->required();
+        opt_max_index->required();
+    }
+
+    void doFedInit() override
+    {
+        pub = fed->registerPublicationIndexed<double>("startup", index);
+        sub = fed->registerSubscriptionIndexed("startup", (index + 1) % maxIndex);
+    }
+
+    void doMakeReady() override
+    {
+        startupTime = std::chrono::steady_clock::now() - startTime;
+        pub.publish(static_cast<double>(index));
+    }
+
+    void doMainLoop() override { fed->requestNextStep(); }
+
+    void doAddBenchmarkResults() override
+    {
+        addResult<long long>("STARTUP TIME (ns)", "startup_time_ns", startupTime.count());
+    }
+};
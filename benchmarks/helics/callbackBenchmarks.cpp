@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/InputBatchCallback.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using helics::core_type;
+
+/** the ways the input updates are delivered to the federate*/
+enum class callback_mode {
+    individual,  //!< a std::function callback on each input
+    federate,  //!< the federate wide std::function callback
+    batch,  //!< a statically typed callback for all inputs
+};
+
+/** a federate with inputs updated every time step and a callback summing the values*/
+static void BMcallback_updates(benchmark::State& state, callback_mode mode)
+{
+    auto count = static_cast<int>(state.range(0));
+    helics::FederateInfo fi(core_type::INPROC);
+    fi.coreInitString = "--autobroker --log_level=no_print";
+    fi.setProperty(helics_property_time_period, 1.0);
+    helics::ValueFederate vFed("callback", fi);
+    std::vector<helics::Publication*> pubs;
+    std::vector<helics::Input*> inputs;
+    for (int ii = 0; ii < count; ++ii) {
+        auto key = "pub" + std::to_string(ii);
+        pubs.push_back(&vFed.registerGlobalPublication<double>(key));
+        inputs.push_back(&vFed.registerSubscription(key));
+    }
+    double sum{0.0};
+    switch (mode) {
+        case callback_mode::individual:
+            for (auto* inp : inputs) {
+                inp->setInputNotificationCallback<double>(
+                    [&sum](const double& val, helics::Time) { sum += val; });
+            }
+            break;
+        case callback_mode::federate:
+            vFed.setInputNotificationCallback(
+                [&sum](helics::Input& inp, helics::Time) { sum += inp.getValue<double>(); });
+            break;
+        case callback_mode::batch:
+            helics::setInputBatchCallback<double>(
+                vFed, inputs, [&sum](helics::Input&, const double& val, helics::Time) {
+                    sum += val;
+                });
+            break;
+    }
+    vFed.enterExecutingMode();
+    double val{0.0};
+    for (auto _ : state) {
+        val += 1.0;
+        for (auto* pub : pubs) {
+            pub->publish(val);
+        }
+        vFed.requestNextStep();
+    }
+    benchmark::DoNotOptimize(sum);
+    vFed.finalize();
+    state.SetItemsProcessed(state.iterations() * count);
+    helics::CoreFactory::cleanUpCores();
+}
+
+BENCHMARK_CAPTURE(BMcallback_updates, individual, callback_mode::individual)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMcallback_updates, federate, callback_mode::federate)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMcallback_updates, batch, callback_mode::batch)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(callbackBenchmark);
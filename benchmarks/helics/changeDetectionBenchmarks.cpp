@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/ChangeDetectionKernels.hpp"
+#include "helics/application_api/HelicsPrimaryTypes.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <complex>
+#include <vector>
+
+using helics::detail::change_kernel;
+
+/** the worst case for change detection is no change so every element is checked*/
+static void BMchange_vector(benchmark::State& state, change_kernel kernel)
+{
+    auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<double> prev(size, 26.5);
+    std::vector<double> vals(size, 26.55);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            helics::detail::anyDifferenceExceeds(prev.data(), vals.data(), size, 0.1, kernel));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+// Register the function as a benchmark
+BENCHMARK_CAPTURE(BMchange_vector, scalar, change_kernel::scalar)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+BENCHMARK_CAPTURE(BMchange_vector, sse2, change_kernel::sse2)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+BENCHMARK_CAPTURE(BMchange_vector, avx, change_kernel::avx)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+
+static void BMchange_complex_vector(benchmark::State& state, change_kernel kernel)
+{
+    auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::complex<double>> prev(size, {26.5, -4.0});
+    std::vector<std::complex<double>> vals(size, {26.55, -4.05});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            helics::detail::anyDifferenceExceeds(prev.data(), vals.data(), size, 0.1, kernel));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK_CAPTURE(BMchange_complex_vector, scalar, change_kernel::scalar)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+BENCHMARK_CAPTURE(BMchange_complex_vector, sse2, change_kernel::sse2)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+BENCHMARK_CAPTURE(BMchange_complex_vector, avx, change_kernel::avx)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 20);
+
+/** change detection through the primary type interface as used by publications and inputs*/
+static void BMchange_detected(benchmark::State& state)
+{
+    auto size = static_cast<std::size_t>(state.range(0));
+    helics::defV prev = std::vector<double>(size, 26.5);
+    std::vector<double> vals(size, 26.55);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(helics::changeDetected(prev, vals, 0.1));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK(BMchange_detected)->RangeMultiplier(8)->Range(1, 1 << 20);
+
+HELICS_BENCHMARK_MAIN(changeDetectionBenchmark);
@@ -5,11 +5,17 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/UnitConversionPlan.hpp"
 #include "helics/application_api/ValueConverter.hpp"
 #include "helics/application_api/ValueConverter_impl.hpp"
 #include "helics_benchmark_main.h"
+#include "units/units/units.hpp"
 
+#include <algorithm>
 #include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 template<class T>
 static void BMconversion(benchmark::State& state, const T& arg)
@@ -41,6 +47,43 @@ BENCHMARK_CAPTURE(BMconversion,
 
 BENCHMARK_CAPTURE(BMconversion, vector_conv, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+BENCHMARK_CAPTURE(BMconversion, vector_conv_large, std::vector<double>(1000, 26.5));
+
+BENCHMARK_CAPTURE(BMconversion,
+                  complex_vector_conv,
+                  std::vector<std::complex<double>>{{26.5, 18.6}, {-48.5, -5.4e-12}});
+
+BENCHMARK_CAPTURE(BMconversion, named_point_conv, helics::NamedPoint{"point", 45.7});
+
+/** conversion through the portable binary archive for comparison with the fixed layout codec*/
+template<class T>
+static void BMconversion_archive(benchmark::State& state, const T& arg)
+{
+    T val{arg};
+    helics::data_block store;
+    for (auto _ : state) {
+        helics::detail::convertValue(val, store, std::false_type{});
+    }
+}
+
+BENCHMARK_CAPTURE(BMconversion_archive, double_conv, -356.56e-27);
+
+BENCHMARK_CAPTURE(BMconversion_archive, int64_conv, int64_t{-12351341});
+
+BENCHMARK_CAPTURE(BMconversion_archive, complex_conv, std::complex<double>{45.7, -19.5});
+
+BENCHMARK_CAPTURE(BMconversion_archive,
+                  vector_conv,
+                  std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
+
+BENCHMARK_CAPTURE(BMconversion_archive, vector_conv_large, std::vector<double>(1000, 26.5));
+
+BENCHMARK_CAPTURE(BMconversion_archive,
+                  complex_vector_conv,
+                  std::vector<std::complex<double>>{{26.5, 18.6}, {-48.5, -5.4e-12}});
+
+BENCHMARK_CAPTURE(BMconversion_archive, named_point_conv, helics::NamedPoint{"point", 45.7});
+
 template<class T>
 static void BMinterpret(benchmark::State& state, const T& arg)
 {
@@ -74,4 +117,93 @@ BENCHMARK_CAPTURE(BMinterpret,
 
 BENCHMARK_CAPTURE(BMinterpret, vector_interp, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+BENCHMARK_CAPTURE(BMinterpret, vector_interp_large, std::vector<double>(1000, 26.5));
+
+BENCHMARK_CAPTURE(BMinterpret,
+                  complex_vector_interp,
+                  std::vector<std::complex<double>>{{26.5, 18.6}, {-48.5, -5.4e-12}});
+
+BENCHMARK_CAPTURE(BMinterpret, named_point_interp, helics::NamedPoint{"point", 45.7});
+
+/** interpretation through the portable binary archive for comparison with the fixed layout codec*/
+template<class T>
+static void BMinterpret_archive(benchmark::State& state, const T& arg)
+{
+    T val{arg};
+    helics::data_block store;
+    helics::ValueConverter<T>::convert(val, store);
+    helics::data_view stv{store};
+    T val2;
+    for (auto _ : state) {
+        helics::detail::interpretValue(stv, val2, std::false_type{});
+    }
+}
+
+BENCHMARK_CAPTURE(BMinterpret_archive, double_interp, -356.56e-27);
+
+BENCHMARK_CAPTURE(BMinterpret_archive, int64_interp, int64_t{-12351341});
+
+BENCHMARK_CAPTURE(BMinterpret_archive, complex_interp, std::complex<double>{45.7, -19.5});
+
+BENCHMARK_CAPTURE(BMinterpret_archive,
+                  vector_interp,
+                  std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
+
+BENCHMARK_CAPTURE(BMinterpret_archive, vector_interp_large, std::vector<double>(1000, 26.5));
+
+BENCHMARK_CAPTURE(BMinterpret_archive,
+                  complex_vector_interp,
+                  std::vector<std::complex<double>>{{26.5, 18.6}, {-48.5, -5.4e-12}});
+
+BENCHMARK_CAPTURE(BMinterpret_archive, named_point_interp, helics::NamedPoint{"point", 45.7});
+
+/** unit conversion of a vector through the units library for each element*/
+static void BMunits_library(benchmark::State& state, const std::string& from, const std::string& to)
+{
+    auto size = static_cast<std::size_t>(state.range(0));
+    auto inUnit = units::unit_from_string(from);
+    auto outUnit = units::unit_from_string(to);
+    const std::vector<double> source(size, 26.5);
+    std::vector<double> vals(size);
+    for (auto _ : state) {
+        for (std::size_t ii = 0; ii < size; ++ii) {
+            vals[ii] = units::convert(source[ii], inUnit, outUnit);
+        }
+        benchmark::DoNotOptimize(vals.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK_CAPTURE(BMunits_library, power, std::string("kW"), std::string("MW"))
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15);
+BENCHMARK_CAPTURE(BMunits_library, temperature, std::string("degC"), std::string("degF"))
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15);
+
+/** unit conversion of a vector through a precomputed plan*/
+static void BMunits_plan(benchmark::State& state, const std::string& from, const std::string& to)
+{
+    auto size = static_cast<std::size_t>(state.range(0));
+    helics::UnitConversionPlan plan(
+        std::make_shared<units::precise_unit>(units::unit_from_string(from)),
+        std::make_shared<units::precise_unit>(units::unit_from_string(to)));
+    const std::vector<double> source(size, 26.5);
+    std::vector<double> vals(size);
+    for (auto _ : state) {
+        // copy so the conversion is applied to the same values each time
+        std::copy(source.begin(), source.end(), vals.begin());
+        plan.apply(vals.data(), vals.size());
+        benchmark::DoNotOptimize(vals.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK_CAPTURE(BMunits_plan, power, std::string("kW"), std::string("MW"))
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15);
+BENCHMARK_CAPTURE(BMunits_plan, temperature, std::string("degC"), std::string("degF"))
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15);
+
 HELICS_BENCHMARK_MAIN(conversionBenchmark);
@@ -0,0 +1,183 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/EndpointInfo.hpp"
+#include "helics/core/TimingWheel.hpp"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+static EndpointInfo makeEndpoint()
+{
+    return EndpointInfo(global_handle(global_federate_id(5), interface_handle(1)), "ept", "");
+}
+
+static std::unique_ptr<Message> makeMessage(Time time, const std::string& source)
+{
+    auto msg = std::make_unique<Message>();
+    msg->time = time;
+    msg->original_source = source;
+    return msg;
+}
+
+/** remove all the messages up to the grant time from the endpoint*/
+static int drain(EndpointInfo& ept, Time grant)
+{
+    int cnt{0};
+    while (ept.getMessage(grant)) {
+        ++cnt;
+    }
+    return cnt;
+}
+
+/** a flood of messages with increasing timestamps from a single source*/
+static void BMendpoint_flood_monotone(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto ept = makeEndpoint();
+    const std::string source("src");
+    Time grant = timeZero;
+    const Time step(1.0);
+    const Time increment = step / static_cast<double>(count + 1);
+    for (auto _ : state) {
+        Time msgTime = grant;
+        for (int ii = 0; ii < count; ++ii) {
+            msgTime += increment;
+            ept.addMessage(makeMessage(msgTime, source));
+        }
+        grant += step;
+        benchmark::DoNotOptimize(ept.queueSize(grant));
+        benchmark::DoNotOptimize(drain(ept, grant));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+// Register the function as a benchmark
+BENCHMARK(BMendpoint_flood_monotone)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+/** a flood of messages at the same time from many sources arriving in an interleaved order*/
+static void BMendpoint_flood_sources(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto ept = makeEndpoint();
+    std::vector<std::string> sources;
+    for (int ii = 0; ii < 64; ++ii) {
+        sources.push_back("fed" + std::to_string(63 - ii));
+    }
+    Time grant = timeZero;
+    const Time step(1.0);
+    for (auto _ : state) {
+        grant += step;
+        for (int ii = 0; ii < count; ++ii) {
+            ept.addMessage(makeMessage(grant, sources[ii % sources.size()]));
+        }
+        benchmark::DoNotOptimize(ept.queueSize(grant));
+        benchmark::DoNotOptimize(drain(ept, grant));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(BMendpoint_flood_sources)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+/** a flood of messages with random timestamps within the next step*/
+static void BMendpoint_flood_random(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto ept = makeEndpoint();
+    const std::string source("src");
+    std::mt19937 gen(167);
+    std::uniform_real_distribution<double> offset(0.0, 1.0);
+    Time grant = timeZero;
+    const Time step(1.0);
+    for (auto _ : state) {
+        for (int ii = 0; ii < count; ++ii) {
+            ept.addMessage(makeMessage(grant + Time(offset(gen)), source));
+        }
+        grant += step;
+        benchmark::DoNotOptimize(ept.queueSize(grant));
+        benchmark::DoNotOptimize(drain(ept, grant));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(BMendpoint_flood_random)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+/** count the messages available in a large queue with messages several steps ahead*/
+static void BMendpoint_queue_size(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto ept = makeEndpoint();
+    const std::string source("src");
+    for (int ii = 0; ii < count; ++ii) {
+        ept.addMessage(makeMessage(Time(ii), source));
+    }
+    const Time query(static_cast<double>(count) / 2.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ept.queueSize(query));
+    }
+}
+
+BENCHMARK(BMendpoint_queue_size)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+/** a large number of messages in flight with random delays of up to 100 steps,  each step a new
+set of messages is sent and the messages that reached the granted time are read
+@param useWheel hold the messages in a timing wheel until their time is granted instead of placing
+them directly in the endpoint queue*/
+static void BMendpoint_delayed(benchmark::State& state, bool useWheel)
+{
+    const auto inFlight = static_cast<int>(state.range(0));
+    constexpr int delaySteps{100};
+    const int perStep = std::max(inFlight / delaySteps, 1);
+    auto ept = makeEndpoint();
+    TimingWheel<std::unique_ptr<Message>> wheel;
+    const std::string source("src");
+    std::mt19937 gen(167);
+    std::uniform_real_distribution<double> delay(0.0, static_cast<double>(delaySteps));
+    Time grant = timeZero;
+    auto send = [&](Time sendTime) {
+        auto msg = makeMessage(sendTime + Time(delay(gen)), source);
+        if (useWheel) {
+            auto msgTime = msg->time;
+            wheel.insert(msgTime, std::move(msg));
+        } else {
+            ept.addMessage(std::move(msg));
+        }
+    };
+    for (int ii = 0; ii < inFlight; ++ii) {
+        send(grant);
+    }
+    const Time step(1.0);
+    for (auto _ : state) {
+        for (int ii = 0; ii < perStep; ++ii) {
+            send(grant);
+        }
+        grant += step;
+        if (useWheel) {
+            wheel.advance(grant, [&ept](Time /*releaseTime*/, std::unique_ptr<Message> msg) {
+                ept.addMessage(std::move(msg));
+            });
+            benchmark::DoNotOptimize(wheel.nextTime());
+        } else {
+            benchmark::DoNotOptimize(ept.firstMessageTime());
+        }
+        benchmark::DoNotOptimize(drain(ept, grant));
+    }
+    state.SetItemsProcessed(state.iterations() * perStep);
+}
+
+BENCHMARK_CAPTURE(BMendpoint_delayed, direct, false)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_CAPTURE(BMendpoint_delayed, timingWheel, true)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 20);
+
+HELICS_BENCHMARK_MAIN(endpointInfoBenchmark);
@@ -18,7 +18,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <memory>
 #include <thread>
+#include <vector>
 
 // static constexpr helics::Time tend = 3600.0_t;  // simulation end time
 
@@ -77,6 +79,58 @@ BENCHMARK(BMfilter_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
+static void BMfilterChain_singleCore(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        constexpr int feds{8};
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        auto wcore = helics::CoreFactory::create(core_type::INPROC,
+                                                 std::string("--autobroker --federates=") +
+                                                     std::to_string(feds + 1));
+        EchoMessageHub hub;
+        hub.initialize(wcore->getIdentifier(), "");
+        std::vector<EchoMessageLeaf> leafs(feds);
+        for (int ii = 0; ii < feds; ++ii) {
+            std::string bmInit = "--index=" + std::to_string(ii);
+            leafs[ii].initialize(wcore->getIdentifier(), bmInit);
+        }
+        // a chain of source filters on Echo all applied within the same core
+        auto chainLength = static_cast<int>(state.range(0));
+        std::vector<std::unique_ptr<helics::Filter>> chain;
+        for (int ii = 0; ii < chainLength; ++ii) {
+            chain.push_back(make_filter(helics::filter_types::delay, wcore.get()));
+            chain.back()->addSourceTarget("echo");
+        }
+
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] =
+                std::thread([&](EchoMessageLeaf& lf) { lf.run([&brr]() { brr.wait(); }); },
+                            std::ref(leafs[ii]));
+        }
+        hub.makeReady();
+        brr.wait();
+        state.ResumeTiming();
+        hub.run([]() {});
+        state.PauseTiming();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        chain.clear();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+// Register the filter chain length benchmarks
+BENCHMARK(BMfilterChain_singleCore)
+    ->DenseRange(1, 10)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static void BMfilter_multiCore(benchmark::State& state, core_type cType)
 {
     for (auto _ : state) {
@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/InputInfo.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+static global_handle sourceHandle(int index)
+{
+    return global_handle(global_federate_id(5), interface_handle(100 + index));
+}
+
+static std::unique_ptr<InputInfo> makeInput(int sources)
+{
+    auto info = std::make_unique<InputInfo>(
+        global_handle(global_federate_id(5), interface_handle(1)), "input", "double", "");
+    for (int ii = 0; ii < sources; ++ii) {
+        info->addSource(sourceHandle(ii), "", "double", "");
+    }
+    return info;
+}
+
+/** a burst of in order values arriving between each time grant*/
+static void BMinputinfo_burst(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto info = makeInput(1);
+    auto src = sourceHandle(0);
+    auto block = std::make_shared<const data_block>("3.14159");
+    Time grant = timeZero;
+    const Time step(1.0);
+    const Time increment = step / static_cast<double>(count + 1);
+    for (auto _ : state) {
+        Time valueTime = grant;
+        for (int ii = 0; ii < count; ++ii) {
+            valueTime += increment;
+            info->addData(src, valueTime, 0, block);
+        }
+        grant += step;
+        benchmark::DoNotOptimize(info->updateTimeInclusive(grant));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+// Register the function as a benchmark
+BENCHMARK(BMinputinfo_burst)->RangeMultiplier(4)->Range(1, 1 << 12);
+
+/** values queued several steps ahead and consumed one step at a time*/
+static void BMinputinfo_lookahead(benchmark::State& state)
+{
+    auto depth = static_cast<int>(state.range(0));
+    auto info = makeInput(1);
+    auto src = sourceHandle(0);
+    auto block = std::make_shared<const data_block>("3.14159");
+    Time next = timeZero;
+    for (int ii = 0; ii < depth; ++ii) {
+        next += 1.0;
+        info->addData(src, next, 0, block);
+    }
+    Time grant = timeZero;
+    for (auto _ : state) {
+        next += 1.0;
+        info->addData(src, next, 0, block);
+        grant += 1.0;
+        benchmark::DoNotOptimize(info->updateTimeUpTo(grant + Time::epsilon()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BMinputinfo_lookahead)->RangeMultiplier(4)->Range(1, 1 << 12);
+
+/** values arriving with pairs swapped so half the insertions are out of order*/
+static void BMinputinfo_out_of_order(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto info = makeInput(1);
+    auto src = sourceHandle(0);
+    auto block = std::make_shared<const data_block>("3.14159");
+    Time grant = timeZero;
+    const Time step(1.0);
+    const Time increment = step / static_cast<double>(count + 2);
+    for (auto _ : state) {
+        Time valueTime = grant;
+        for (int ii = 0; ii < count; ii += 2) {
+            info->addData(src, valueTime + increment * 2, 0, block);
+            info->addData(src, valueTime + increment, 0, block);
+            valueTime += increment * 2;
+        }
+        grant += step;
+        benchmark::DoNotOptimize(info->updateTimeInclusive(grant));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BMinputinfo_out_of_order)->RangeMultiplier(4)->Range(2, 1 << 12);
+
+/** many sources each sending a few values between each time grant*/
+static void BMinputinfo_multi_source(benchmark::State& state)
+{
+    auto sources = static_cast<int>(state.range(0));
+    constexpr int valuesPerSource{8};
+    auto info = makeInput(sources);
+    std::vector<global_handle> handles;
+    for (int ii = 0; ii < sources; ++ii) {
+        handles.push_back(sourceHandle(ii));
+    }
+    auto block = std::make_shared<const data_block>("3.14159");
+    Time grant = timeZero;
+    const Time step(1.0);
+    const Time increment = step / static_cast<double>(valuesPerSource + 1);
+    for (auto _ : state) {
+        Time valueTime = grant;
+        for (int ii = 0; ii < valuesPerSource; ++ii) {
+            valueTime += increment;
+            for (const auto& src : handles) {
+                info->addData(src, valueTime, 0, block);
+            }
+        }
+        grant += step;
+        benchmark::DoNotOptimize(info->updateTimeInclusive(grant));
+    }
+    state.SetItemsProcessed(state.iterations() * sources * valuesPerSource);
+}
+BENCHMARK(BMinputinfo_multi_source)->RangeMultiplier(4)->Range(1, 256);
+
+HELICS_BENCHMARK_MAIN(inputInfoBenchmark);
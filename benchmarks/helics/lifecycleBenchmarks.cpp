@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+using helics::core_type;
+
+/** run a complete single federate federation lifecycle: create, connect, execute, finalize*/
+static void runFederationLifecycle(const helics::FederateInfo& fi)
+{
+    helics::ValueFederate vFed("lifecycle", fi);
+    auto& pub = vFed.registerGlobalPublication<double>("lifecycle_pub");
+    auto& sub = vFed.registerSubscription("lifecycle_pub");
+    vFed.enterExecutingMode();
+    pub.publish(1.0);
+    vFed.requestNextStep();
+    benchmark::DoNotOptimize(sub.getValue<double>());
+    vFed.finalize();
+}
+
+static void BMlifecycle(benchmark::State& state, core_type cType, bool pooled)
+{
+    auto broker = helics::BrokerFactory::create(cType, "--log_level=no_print");
+    helics::FederateInfo fi(cType);
+    fi.broker = broker->getIdentifier();
+    fi.coreInitString = "--log_level=no_print";
+    if (pooled) {
+        helics::CoreFactory::setCorePool(cType, helics::generateFullCoreInitString(fi), 4);
+    }
+    for (auto _ : state) {
+        runFederationLifecycle(fi);
+        state.PauseTiming();
+        // clean up the finished cores outside of the timing loop
+        helics::CoreFactory::cleanUpCores();
+        state.ResumeTiming();
+    }
+    if (pooled) {
+        helics::CoreFactory::clearCorePools();
+    }
+    broker->disconnect();
+    broker.reset();
+    helics::cleanupHelicsLibrary();
+}
+
+BENCHMARK_CAPTURE(BMlifecycle, inprocCore, core_type::INPROC, false)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMlifecycle, inprocCorePooled, core_type::INPROC, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#ifdef ENABLE_ZMQ_CORE
+BENCHMARK_CAPTURE(BMlifecycle, zmqCore, core_type::ZMQ, false)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(20)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMlifecycle, zmqCorePooled, core_type::ZMQ, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(20)
+    ->UseRealTime();
+#endif
+
+#ifdef ENABLE_TCP_CORE
+BENCHMARK_CAPTURE(BMlifecycle, tcpCore, core_type::TCP, false)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(20)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMlifecycle, tcpCorePooled, core_type::TCP, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(20)
+    ->UseRealTime();
+#endif
+
+// Run the benchmarks
+HELICS_BENCHMARK_MAIN(lifecycleBenchmark);
@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/MessageFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using helics::core_type;
+
+/** a federate sending many small messages between two of its endpoints every time step*/
+static void BMmessage_exchange(benchmark::State& state, bool batch)
+{
+    auto count = static_cast<int>(state.range(0));
+    helics::FederateInfo fi(core_type::INPROC);
+    fi.coreInitString = "--autobroker --log_level=no_print";
+    fi.setProperty(helics_property_time_period, 1.0);
+    helics::MessageFederate mFed(batch ? "batch" : "single", fi);
+    auto& src = mFed.registerGlobalEndpoint("src");
+    auto& dest = mFed.registerGlobalEndpoint("dest");
+    src.setDefaultDestination("dest");
+    const std::string payload(16, 'a');
+    std::vector<helics::data_view> data(count, payload);
+    mFed.enterExecutingMode();
+    std::size_t received{0};
+    for (auto _ : state) {
+        if (batch) {
+            src.sendBatch(data);
+        } else {
+            for (const auto& msg : data) {
+                src.send(msg);
+            }
+        }
+        mFed.requestNextStep();
+        if (batch) {
+            received += dest.receiveBatch(count).size();
+        } else {
+            while (dest.getMessage()) {
+                ++received;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(received);
+    mFed.finalize();
+    state.SetItemsProcessed(state.iterations() * count);
+    helics::CoreFactory::cleanUpCores();
+}
+
+BENCHMARK_CAPTURE(BMmessage_exchange, single, false)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMmessage_exchange, batch, true)
+    ->RangeMultiplier(8)
+    ->Range(1, 1 << 15)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(messageBatchBenchmark);
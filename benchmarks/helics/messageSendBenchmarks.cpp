@@ -155,6 +155,16 @@ BENCHMARK_CAPTURE(BMsendMessage, multiCore/zmqssCore, core_type::ZMQ_SS)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the ZMQ large payload benchmarks,  messages over the chunk size are sent in chunks
+// clang-format off
+BENCHMARK_CAPTURE(BMsendMessage, largePayload/zmqCore, core_type::ZMQ)
+    // clang-format on
+    ->RangeMultiplier(4)
+    ->Ranges({{1 << 16, 1 << 26}, {1, 1}})
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #endif
 
 #ifdef ENABLE_IPC_CORE
@@ -199,6 +209,16 @@ BENCHMARK_CAPTURE(BMsendMessage, multiCore/tcpssCore, core_type::TCP_SS)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+// Register the TCP large payload benchmarks,  messages over the chunk size are sent in chunks
+// clang-format off
+BENCHMARK_CAPTURE(BMsendMessage, largePayload/tcpCore, core_type::TCP)
+    // clang-format on
+    ->RangeMultiplier(4)
+    ->Ranges({{1 << 16, 1 << 26}, {1, 1}})
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #endif
 
 #ifdef ENABLE_UDP_CORE
@@ -0,0 +1,37 @@
+#!/bin/bash
+
+# Launches a broker and N startup benchmark federate processes on the local machine and reports the
+# total wall clock time taken for the federation to complete
+# Args: build bin folder, number of federates, core type, output folder
+# Passthrough at end of arg handling: extra broker arguments (such as --connection_batch=100)
+
+helics_bin_dir=${1:-../../../build/bin}
+shift
+fed_count=${1:-100}
+shift
+core_type=${1:-zmq}
+shift
+output_dir=${1:-startup-${core_type}-${fed_count}}
+shift
+
+mkdir -p "${output_dir}"
+
+start_time=$(date +%s%N)
+
+echo "Running: \"${helics_bin_dir}/helics_broker\" --type=${core_type} -f ${fed_count} $*"
+"${helics_bin_dir}/helics_broker" --type="${core_type}" -f "${fed_count}" "$@" >"${output_dir}/broker-out.txt" 2>&1 &
+broker_pid=$!
+
+for ((i = 0; i < fed_count; i++)); do
+    "${helics_bin_dir}/helics_benchmarks" startup --index="${i}" --max_index="${fed_count}" --coretype="${core_type}" >"${output_dir}/startup-${i}-out.txt" 2>&1 &
+done
+
+# wait until all federates and the broker are done running
+wait "${broker_pid}"
+wait
+
+end_time=$(date +%s%N)
+
+echo "FEDERATES=${fed_count}"
+echo "CORE_TYPE=${core_type}"
+echo "TOTAL_TIME_MS=$(((end_time - start_time) / 1000000))"
@@ -0,0 +1,84 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/RoutingTable.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+/** generate a random lookup sequence of federate ids over count federates*/
+static std::vector<global_federate_id> generateLookups(int count)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, count - 1);
+    std::vector<global_federate_id> lookups(1024);
+    for (auto& fid : lookups) {
+        fid = global_federate_id(global_federate_id_shift + dist(gen));
+    }
+    return lookups;
+}
+
+static void BMroutingTable(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    RoutingTable table;
+    for (int ii = 0; ii < count; ++ii) {
+        table.emplace(global_federate_id(global_federate_id_shift + ii), route_id(ii % 17));
+    }
+    auto lookups = generateLookups(count);
+    std::size_t index{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.getRoute(lookups[index]));
+        index = (index + 1) & 1023U;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMroutingTable)->RangeMultiplier(8)->Range(8, 32768);
+
+static void BMroutingUnorderedMap(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    std::unordered_map<global_federate_id, route_id> table;
+    for (int ii = 0; ii < count; ++ii) {
+        table.emplace(global_federate_id(global_federate_id_shift + ii), route_id(ii % 17));
+    }
+    auto lookups = generateLookups(count);
+    std::size_t index{0};
+    for (auto _ : state) {
+        auto fnd = table.find(lookups[index]);
+        benchmark::DoNotOptimize((fnd != table.end()) ? fnd->second : parent_route_id);
+        index = (index + 1) & 1023U;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMroutingUnorderedMap)->RangeMultiplier(8)->Range(8, 32768);
+
+static void BMroutingMap(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    std::map<global_federate_id, route_id> table;
+    for (int ii = 0; ii < count; ++ii) {
+        table.emplace(global_federate_id(global_federate_id_shift + ii), route_id(ii % 17));
+    }
+    auto lookups = generateLookups(count);
+    std::size_t index{0};
+    for (auto _ : state) {
+        auto fnd = table.find(lookups[index]);
+        benchmark::DoNotOptimize((fnd != table.end()) ? fnd->second : parent_route_id);
+        index = (index + 1) & 1023U;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMroutingMap)->RangeMultiplier(8)->Range(8, 32768);
+
+HELICS_BENCHMARK_MAIN(routingBenchmark);
@@ -0,0 +1,162 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <gmlc/concurrency/Barrier.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using helics::core_type;
+
+/** generate a federate with a ring of connections and an unconnected input
+@details the federates connect to their neighbor by name so the broker has to match all the
+interfaces and report on the unknown ones during the initialization phase*/
+static std::unique_ptr<helics::ValueFederate>
+    generateStartupFederate(const std::string& coreName, int index, int feds, int interfaces)
+{
+    helics::FederateInfo fi;
+    fi.coreName = coreName;
+    auto vFed = std::make_unique<helics::ValueFederate>("startup_" + std::to_string(index), fi);
+    for (int jj = 0; jj < interfaces; ++jj) {
+        vFed->registerGlobalPublication<double>("pub_" + std::to_string(index) + "_" +
+                                                std::to_string(jj));
+        vFed->registerSubscription("pub_" + std::to_string((index + 1) % feds) + "_" +
+                                   std::to_string(jj));
+    }
+    vFed->registerSubscription("missing_" + std::to_string(index));
+    return vFed;
+}
+
+static void BMstartup_singleCore(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int feds = static_cast<int>(state.range(0));
+        int interfaces = static_cast<int>(state.range(1));
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        auto wcore = helics::CoreFactory::create(core_type::INPROC,
+                                                 std::string("--autobroker --federates=") +
+                                                     std::to_string(feds) +
+                                                     " --log_level=no_print");
+        std::vector<std::unique_ptr<helics::ValueFederate>> vFeds(feds);
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        state.ResumeTiming();
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] = std::thread([&, ii]() {
+                vFeds[ii] = generateStartupFederate(wcore->getIdentifier(), ii, feds, interfaces);
+                vFeds[ii]->enterExecutingMode();
+                brr.wait();
+            });
+        }
+        brr.wait();
+        state.PauseTiming();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        for (auto& vFed : vFeds) {
+            vFed->finalize();
+        }
+        vFeds.clear();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+static constexpr int64_t maxscale{1U << (6 + HELICS_BENCHMARK_SHIFT_FACTOR)};
+// Register the function as a benchmark
+BENCHMARK(BMstartup_singleCore)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, maxscale}, {1, 64}})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+static void BMstartup_multiCore(benchmark::State& state, core_type cType)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        int feds = static_cast<int>(state.range(0));
+        int interfaces = static_cast<int>(state.range(1));
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
+        auto broker = helics::BrokerFactory::create(cType,
+                                                    "brokerstartup",
+                                                    std::string("--federates=") +
+                                                        std::to_string(feds));
+        broker->setLoggingLevel(helics_log_level_no_print);
+        std::vector<std::shared_ptr<helics::Core>> cores(feds);
+        std::vector<std::unique_ptr<helics::ValueFederate>> vFeds(feds);
+        std::vector<std::thread> threadlist(static_cast<size_t>(feds));
+        for (int ii = 0; ii < feds; ++ii) {
+            cores[ii] = helics::CoreFactory::create(cType, "-f 1 --log_level=no_print");
+            cores[ii]->connect();
+        }
+        state.ResumeTiming();
+        for (int ii = 0; ii < feds; ++ii) {
+            threadlist[ii] = std::thread([&, ii]() {
+                vFeds[ii] =
+                    generateStartupFederate(cores[ii]->getIdentifier(), ii, feds, interfaces);
+                vFeds[ii]->enterExecutingMode();
+                brr.wait();
+            });
+        }
+        brr.wait();
+        state.PauseTiming();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        for (auto& vFed : vFeds) {
+            vFed->finalize();
+        }
+        vFeds.clear();
+        broker->disconnect();
+        broker.reset();
+        cores.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+// Register the inproc core benchmarks
+BENCHMARK_CAPTURE(BMstartup_multiCore, inprocCore, core_type::INPROC)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, maxscale}, {1, 64}})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+#ifdef ENABLE_ZMQ_CORE
+// Register the ZMQ benchmarks
+BENCHMARK_CAPTURE(BMstartup_multiCore, zmqCore, core_type::ZMQ)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, maxscale}, {1, 16}})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+#endif
+
+#ifdef ENABLE_TCP_CORE
+// Register the TCP benchmarks
+BENCHMARK_CAPTURE(BMstartup_multiCore, tcpCore, core_type::TCP)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, maxscale}, {1, 16}})
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+#endif
+
+HELICS_BENCHMARK_MAIN(startupBenchmark);
@@ -27,6 +27,12 @@
 %ignore helics_error;
 %ignore helicsMessageGetRawDataPointer;
 %ignore helicsMessageResize;
+%ignore helicsInputGetVectorView;
+%ignore helicsFederatePublishBatch;
+%ignore helicsFederateGetInputDoubles;
+%ignore helicsEndpointSendBatch;
+%ignore helicsEndpointReceiveBatch;
+%ignore helicsFederateReceiveBatch;
 
 %include "../helics_enums.h"
 %include "api-data.h"
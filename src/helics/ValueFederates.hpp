@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "application_api/CoreApp.hpp"
+#include "application_api/InputBatchCallback.hpp"
 #include "application_api/Inputs.hpp"
 #include "application_api/Publications.hpp"
 #include "application_api/Subscriptions.hpp"
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "application_api/CoreApp.hpp"
 #include "application_api/Endpoints.hpp"
 #include "application_api/Filters.hpp"
+#include "application_api/InputBatchCallback.hpp"
 #include "application_api/Inputs.hpp"
 #include "application_api/MessageOperators.hpp"
 #include "application_api/Publications.hpp"
@@ -0,0 +1,233 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "ChangeDetectionKernels.hpp"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) ||                               \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define HELICS_CHANGE_KERNELS_X86
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+// msvc allows the avx intrinsics in any function
+#        define HELICS_TARGET_AVX
+#    else
+#        define HELICS_TARGET_AVX __attribute__((target("avx")))
+#    endif
+#endif
+
+namespace helics {
+namespace detail {
+    /** the number of doubles checked in each block of the vector kernels before testing for an
+     * early exit*/
+    static constexpr std::size_t blockSize{16};
+    /** factor applied to the limit when filtering complex values,  if both parts of a difference
+    are below deltaV/sqrt(2) the magnitude cannot exceed deltaV so the factor is slightly below
+    1/sqrt(2) to leave room for rounding*/
+    static constexpr double complexFilterFactor{0.7071};
+
+    static bool exceedsScalar(const double* prev,
+                              const double* vals,
+                              std::size_t count,
+                              double deltaV)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            if (std::abs(prev[ii] - vals[ii]) > deltaV) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool exceedsScalar(const std::complex<double>* prev,
+                              const std::complex<double>* vals,
+                              std::size_t count,
+                              double deltaV)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            if (std::abs(prev[ii] - vals[ii]) > deltaV) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+#ifdef HELICS_CHANGE_KERNELS_X86
+    /** compare a block of doubles and return a nonzero mask if any difference exceeds the limit*/
+    static inline int sse2BlockMask(const double* prev, const double* vals, __m128d limit)
+    {
+        const __m128d signMask = _mm_set1_pd(-0.0);
+        __m128d cmp = _mm_setzero_pd();
+        for (std::size_t jj = 0; jj < blockSize; jj += 2) {
+            __m128d diff = _mm_andnot_pd(
+                signMask, _mm_sub_pd(_mm_loadu_pd(prev + jj), _mm_loadu_pd(vals + jj)));
+            // ordered comparison so NaN differences compare false like the scalar code
+            cmp = _mm_or_pd(cmp, _mm_cmpgt_pd(diff, limit));
+        }
+        return _mm_movemask_pd(cmp);
+    }
+
+    static bool
+        exceedsSse2(const double* prev, const double* vals, std::size_t count, double deltaV)
+    {
+        const __m128d limit = _mm_set1_pd(deltaV);
+        std::size_t ii{0};
+        for (; ii + blockSize <= count; ii += blockSize) {
+            if (sse2BlockMask(prev + ii, vals + ii, limit) != 0) {
+                return true;
+            }
+        }
+        return exceedsScalar(prev + ii, vals + ii, count - ii, deltaV);
+    }
+
+    static bool exceedsSse2(const std::complex<double>* prev,
+                            const std::complex<double>* vals,
+                            std::size_t count,
+                            double deltaV)
+    {
+        const __m128d limit = _mm_set1_pd(deltaV * complexFilterFactor);
+        // std::complex<double> is guaranteed to have the layout of double[2]
+        const auto* prevParts = reinterpret_cast<const double*>(prev);
+        const auto* valParts = reinterpret_cast<const double*>(vals);
+        constexpr std::size_t complexBlock{blockSize / 2};
+        std::size_t ii{0};
+        for (; ii + complexBlock <= count; ii += complexBlock) {
+            if (sse2BlockMask(prevParts + 2 * ii, valParts + 2 * ii, limit) != 0 &&
+                exceedsScalar(prev + ii, vals + ii, complexBlock, deltaV)) {
+                return true;
+            }
+        }
+        return exceedsScalar(prev + ii, vals + ii, count - ii, deltaV);
+    }
+
+    HELICS_TARGET_AVX static inline int
+        avxBlockMask(const double* prev, const double* vals, __m256d limit)
+    {
+        const __m256d signMask = _mm256_set1_pd(-0.0);
+        __m256d cmp = _mm256_setzero_pd();
+        for (std::size_t jj = 0; jj < blockSize; jj += 4) {
+            __m256d diff = _mm256_andnot_pd(
+                signMask, _mm256_sub_pd(_mm256_loadu_pd(prev + jj), _mm256_loadu_pd(vals + jj)));
+            cmp = _mm256_or_pd(cmp, _mm256_cmp_pd(diff, limit, _CMP_GT_OQ));
+        }
+        return _mm256_movemask_pd(cmp);
+    }
+
+    HELICS_TARGET_AVX static bool
+        exceedsAvx(const double* prev, const double* vals, std::size_t count, double deltaV)
+    {
+        const __m256d limit = _mm256_set1_pd(deltaV);
+        std::size_t ii{0};
+        for (; ii + blockSize <= count; ii += blockSize) {
+            if (avxBlockMask(prev + ii, vals + ii, limit) != 0) {
+                return true;
+            }
+        }
+        return exceedsScalar(prev + ii, vals + ii, count - ii, deltaV);
+    }
+
+    HELICS_TARGET_AVX static bool exceedsAvx(const std::complex<double>* prev,
+                                             const std::complex<double>* vals,
+                                             std::size_t count,
+                                             double deltaV)
+    {
+        const __m256d limit = _mm256_set1_pd(deltaV * complexFilterFactor);
+        const auto* prevParts = reinterpret_cast<const double*>(prev);
+        const auto* valParts = reinterpret_cast<const double*>(vals);
+        constexpr std::size_t complexBlock{blockSize / 2};
+        std::size_t ii{0};
+        for (; ii + complexBlock <= count; ii += complexBlock) {
+            if (avxBlockMask(prevParts + 2 * ii, valParts + 2 * ii, limit) != 0 &&
+                exceedsScalar(prev + ii, vals + ii, complexBlock, deltaV)) {
+                return true;
+            }
+        }
+        return exceedsScalar(prev + ii, vals + ii, count - ii, deltaV);
+    }
+#endif
+
+    static change_kernel detectChangeKernel()
+    {
+#ifdef HELICS_CHANGE_KERNELS_X86
+#    if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        // the operating system must also save the avx registers
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            return change_kernel::avx;
+        }
+#    else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx")) {
+            return change_kernel::avx;
+        }
+#    endif
+        return change_kernel::sse2;
+#else
+        return change_kernel::scalar;
+#endif
+    }
+
+    change_kernel bestChangeKernel()
+    {
+        static const change_kernel best = detectChangeKernel();
+        return best;
+    }
+
+    static change_kernel selectKernel(change_kernel requested)
+    {
+        auto best = bestChangeKernel();
+        return (static_cast<int>(requested) > static_cast<int>(best)) ? best : requested;
+    }
+
+    bool anyDifferenceExceeds(const double* prev,
+                              const double* vals,
+                              std::size_t count,
+                              double deltaV,
+                              change_kernel kernel)
+    {
+        if (count < blockSize) {
+            return exceedsScalar(prev, vals, count, deltaV);
+        }
+        switch (selectKernel(kernel)) {
+#ifdef HELICS_CHANGE_KERNELS_X86
+            case change_kernel::avx:
+                return exceedsAvx(prev, vals, count, deltaV);
+            case change_kernel::sse2:
+                return exceedsSse2(prev, vals, count, deltaV);
+#endif
+            default:
+                return exceedsScalar(prev, vals, count, deltaV);
+        }
+    }
+
+    bool anyDifferenceExceeds(const std::complex<double>* prev,
+                              const std::complex<double>* vals,
+                              std::size_t count,
+                              double deltaV,
+                              change_kernel kernel)
+    {
+        if (count < blockSize) {
+            return exceedsScalar(prev, vals, count, deltaV);
+        }
+        switch (selectKernel(kernel)) {
+#ifdef HELICS_CHANGE_KERNELS_X86
+            case change_kernel::avx:
+                return exceedsAvx(prev, vals, count, deltaV);
+            case change_kernel::sse2:
+                return exceedsSse2(prev, vals, count, deltaV);
+#endif
+            default:
+                return exceedsScalar(prev, vals, count, deltaV);
+        }
+    }
+}  // namespace detail
+}  // namespace helics
@@ -0,0 +1,46 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <complex>
+#include <cstddef>
+
+namespace helics {
+namespace detail {
+    /** the instruction sets available for the change detection kernels*/
+    enum class change_kernel : int {
+        scalar = 0,  //!< plain loop
+        sse2 = 1,  //!< 128 bit vectors
+        avx = 2,  //!< 256 bit vectors
+        automatic = 99,  //!< the best kernel supported by the processor
+    };
+
+    /** get the best kernel supported by the processor the code is running on*/
+    change_kernel bestChangeKernel();
+
+    /** check if any element of two arrays differs by more than deltaV
+    @details the result is identical to checking std::abs(prev[ii]-vals[ii])>deltaV for each
+    element,  so NaN differences are not treated as changes
+    @param kernel the kernel to use,  if it is not supported by the processor the best supported
+    kernel is used instead*/
+    bool anyDifferenceExceeds(const double* prev,
+                              const double* vals,
+                              std::size_t count,
+                              double deltaV,
+                              change_kernel kernel = change_kernel::automatic);
+
+    /** check if the magnitude of the difference of any element of two complex arrays exceeds deltaV
+    @details the result is identical to checking std::abs(prev[ii]-vals[ii])>deltaV for each
+    element,  the vector kernels only filter out blocks that cannot exceed the limit and the
+    remaining blocks are checked exactly*/
+    bool anyDifferenceExceeds(const std::complex<double>* prev,
+                              const std::complex<double>* vals,
+                              std::size_t count,
+                              double deltaV,
+                              change_kernel kernel = change_kernel::automatic);
+}  // namespace detail
+}  // namespace helics
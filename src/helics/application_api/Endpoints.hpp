@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace helics {
 /** class to manage an endpoint */
@@ -22,6 +23,7 @@ class HELICS_CXX_EXPORT Endpoint {
     int referenceIndex{-1};  //!< an index used for callback lookup
     void* dataReference{nullptr};  //!< pointer to a piece of containing data
     std::string targetDest;  //!< a predefined target destination
+    int32_t targetIndex{-1};  //!< the identifier of the target destination in the core
     std::string actualName;  //!< the name of the endpoint
     bool disableAssign{false};  //!< disable assignment for the object
   public:
@@ -110,7 +112,7 @@ class HELICS_CXX_EXPORT Endpoint {
     */
     void send(const char* data, size_t data_size, Time sendTime) const
     {
-        fed->sendMessage(*this, targetDest, data_view{data, data_size}, sendTime);
+        sendToTarget(data_view{data, data_size}, sendTime);
     }
     /** send a data_view
     @details a data view can convert from many different formats so this function should
@@ -139,24 +141,21 @@ class HELICS_CXX_EXPORT Endpoint {
     */
     void send(const char* data, size_t data_size) const
     {
-        fed->sendMessage(*this, targetDest, data_view{data, data_size});
+        sendToTarget(data_view{data, data_size}, Time::minVal());
     }
     /** send a data_view to the target destination
     @details a data view can convert from many different formats so this function should
     be catching many of the common use cases
     @param data the information to send
     */
-    void send(const data_view& data) const { fed->sendMessage(*this, targetDest, data); }
+    void send(const data_view& data) const { sendToTarget(data, Time::minVal()); }
     /** send a data_view to the specified target destination
     @details a data view can convert from many different formats so this function should
     be catching many of the common use cases
     @param data a representation to send
     @param sendTime  the time the message should be sent
     */
-    void send(const data_view& data, Time sendTime) const
-    {
-        fed->sendMessage(*this, targetDest, data, sendTime);
-    }
+    void send(const data_view& data, Time sendTime) const { sendToTarget(data, sendTime); }
     /** send a pointer to a message object*/
     void send(std::unique_ptr<Message> mess) const
     {
@@ -170,8 +169,25 @@ class HELICS_CXX_EXPORT Endpoint {
     @param mess a reference to an actual message object
     */
     void send(const Message& mess) const { send(std::make_unique<Message>(mess)); }
+    /** send a batch of messages in a single call
+    @param destinations the destinations of the messages,  a single destination is used for all
+    the messages
+    @param data the data of the messages,  a single data_view is sent to all the destinations
+    */
+    void sendBatch(const std::vector<std::string>& destinations,
+                   const std::vector<data_view>& data) const
+    {
+        fed->sendBatch(*this, destinations, data);
+    }
+    /** send a batch of messages to the target destination*/
+    void sendBatch(const std::vector<data_view>& data) const
+    {
+        fed->sendBatch(*this, std::vector<std::string>{targetDest}, data);
+    }
     /** get an available message if there is no message the returned object is empty*/
     auto getMessage() const { return fed->getMessage(*this); }
+    /** get up to maxCount available messages*/
+    auto receiveBatch(int maxCount) const { return fed->receiveBatch(*this, maxCount); }
     /** check if there is a message available*/
     bool hasMessage() const { return fed->hasMessage(*this); }
     /** check if there is a message available*/
@@ -194,8 +210,16 @@ class HELICS_CXX_EXPORT Endpoint {
     {
         fed->addDestinationFilter(*this, filterName);
     }
-    /** set a target destination for unspecified messages*/
-    void setDefaultDestination(std::string target) { targetDest = std::move(target); }
+    /** set a target destination for unspecified messages
+    @details the destination is registered with the core so repeated sends to it do not need to
+    process the name*/
+    void setDefaultDestination(std::string target)
+    {
+        targetDest = std::move(target);
+        targetIndex = (fed != nullptr && !targetDest.empty()) ?
+            fed->registerDestination(targetDest) :
+            -1;
+    }
     /** get the target destination for the endpoint*/
     const std::string& getDefaultDestination() const { return targetDest; }
     /** get the name of the endpoint*/
@@ -212,10 +236,10 @@ class HELICS_CXX_EXPORT Endpoint {
     const std::string& getInfo() const { return fed->getInfo(handle); }
     /** set the interface information field of the publication*/
     void setInfo(const std::string& info) { fed->setInfo(handle, info); }
-    void setOption(int32_t option, int32_t value)
-    {
-        fed->setInterfaceOption(handle, option, value);
-    }
+    /** set an option on the endpoint
+    @details the receive queue capacity and overflow policy options limit the number of messages
+    held for the endpoint see \ref helics_queue_overflow_policy*/
+    void setOption(int32_t option, int32_t value) { fed->setEndpointOption(*this, option, value); }
 
     /** get the current value of a flag for the handle*/
     int32_t getOption(int32_t option) const { return fed->getInterfaceOption(handle, option); }
@@ -223,6 +247,15 @@ class HELICS_CXX_EXPORT Endpoint {
     void close() { fed->closeInterface(handle); }
 
   private:
+    /** send data to the target destination*/
+    void sendToTarget(const data_view& data, Time sendTime) const
+    {
+        if (targetIndex >= 0) {
+            fed->sendMessage(*this, targetIndex, data, sendTime);
+        } else {
+            fed->sendMessage(*this, targetDest, data, sendTime);
+        }
+    }
     friend class MessageFederateManager;
 };
 }  // namespace helics
@@ -154,7 +154,12 @@ static const std::map<std::string, int> optionStringsTranslations{
     {"input_priority_location", helics_handle_option_input_priority_location},
     {"priority_location", helics_handle_option_input_priority_location},
     {"multi_input_handling_method", helics_handle_option_multi_input_handling_method},
-    {"multi_input_handling", helics_handle_option_multi_input_handling_method}};
+    {"multi_input_handling", helics_handle_option_multi_input_handling_method},
+    {"receive_queue_capacity", helics_handle_option_receive_queue_capacity},
+    {"queue_capacity", helics_handle_option_receive_queue_capacity},
+    {"receive_queue_overflow_policy", helics_handle_option_receive_queue_overflow_policy},
+    {"queue_overflow_policy", helics_handle_option_receive_queue_overflow_policy},
+    {"overflow_policy", helics_handle_option_receive_queue_overflow_policy}};
 
 static const std::map<std::string, int> option_value_map{
     {"0", 0},
@@ -181,7 +186,10 @@ static const std::map<std::string, int> option_value_map{
     {"average", helics_multi_input_average_operation},
     {"mean", helics_multi_input_average_operation},
     {"vectorize", helics_multi_input_vectorize_operation},
-    {"diff", helics_multi_input_diff_operation}};
+    {"diff", helics_multi_input_diff_operation},
+    // queue overflow policies
+    {"drop_oldest", helics_queue_overflow_drop_oldest},
+    {"drop_newest", helics_queue_overflow_drop_newest}};
 
 static const std::map<std::string, int> log_level_map{{"none", helics_log_level_no_print},
                                                       {"no_print", helics_log_level_no_print},
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "FilterOperations.hpp"
 
 #include "../core/Core.hpp"
+#include "../core/FilterExpression.hpp"
 #include "../core/core-exceptions.hpp"
 #include "../utilities/timeStringOps.hpp"
 #include "MessageOperators.hpp"
@@ -420,4 +421,33 @@ std::vector<std::unique_ptr<Message>> CloneFilterOperation::sendMessage(const Me
     }
     return messages;
 }
+
+ExpressionFilterOperation::ExpressionFilterOperation():
+    op(std::make_shared<ExpressionFilterOperator>())
+{
+}
+
+ExpressionFilterOperation::~ExpressionFilterOperation() = default;
+
+void ExpressionFilterOperation::set(const std::string& property, double /*val*/)
+{
+    throw(
+        helics::InvalidParameter(std::string("property " + property + " is not a known property")));
+}
+
+void ExpressionFilterOperation::setString(const std::string& property, const std::string& val)
+{
+    if (property == "expression") {
+        // the expression is compiled here so the core only evaluates the compiled rules
+        op->setExpression(std::make_shared<const FilterExpression>(val));
+    } else {
+        throw(helics::InvalidParameter(
+            std::string("property " + property + " is not a known property")));
+    }
+}
+
+std::shared_ptr<FilterOperator> ExpressionFilterOperation::getOperator()
+{
+    return std::static_pointer_cast<FilterOperator>(op);
+}
 }  // namespace helics
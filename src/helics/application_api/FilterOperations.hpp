@@ -29,6 +29,7 @@ class MessageConditionalOperator;
 class MessageDestOperator;
 class CloneOperator;
 class FirewallOperator;
+class ExpressionFilterOperator;
 /** class for managing filter operations*/
 class FilterOperations {
   public:
@@ -161,4 +162,19 @@ class CloneFilterOperation: public FilterOperations {
     std::vector<std::unique_ptr<Message>> sendMessage(const Message* mess) const;
 };
 
+/** filter applying a set of declarative rules which are compiled once and evaluated in the core
+@details the rules are set through the "expression" string property,  see FilterExpression for the
+syntax*/
+class ExpressionFilterOperation: public FilterOperations {
+  private:
+    std::shared_ptr<ExpressionFilterOperator> op;  //!< the actual operator
+
+  public:
+    ExpressionFilterOperation();
+    ~ExpressionFilterOperation();
+    virtual void set(const std::string& property, double val) override;
+    virtual void setString(const std::string& property, const std::string& val) override;
+    virtual std::shared_ptr<FilterOperator> getOperator() override;
+};
+
 }  // namespace helics
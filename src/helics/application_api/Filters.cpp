@@ -32,6 +32,7 @@ static const std::map<std::string, filter_types> filterTypes{
     {"reroute", filter_types::reroute},
     {"redirect", filter_types::reroute},
     {"firewall", filter_types::firewall},
+    {"expression", filter_types::expression},
     {"custom", filter_types::custom}};
 
 filter_types filterTypeFromString(const std::string& filterType) noexcept
@@ -79,6 +80,10 @@ void addOperations(Filter* filt, filter_types type, Core* /*cptr*/)
             auto op = std::make_shared<FirewallFilterOperation>();
             filt->setFilterOperations(std::move(op));
         } break;
+        case filter_types::expression: {
+            auto op = std::make_shared<ExpressionFilterOperation>();
+            filt->setFilterOperations(std::move(op));
+        } break;
     }
 }
 
@@ -26,7 +26,8 @@ enum class filter_types {
     reroute = helics_filter_type_reroute,
     clone = helics_filter_type_clone,
     firewall = helics_filter_type_firewall,
-    unrecognized = 7
+    expression = helics_filter_type_expression,
+    unrecognized = 8
 
 };
 
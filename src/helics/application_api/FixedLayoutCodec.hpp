@@ -0,0 +1,286 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+/** @file
+fixed layout encoding of the primary value types without going through archive and stream objects
+@details the byte layout is identical to the portable binary archive format used for all other
+types so data encoded either way can be read by either,  the first byte is a format marker which
+for the portable binary layout is the endianness of the writer (1 for little endian, 0 for big
+endian),  other marker values are reserved for future layouts and are rejected by the decoder
+*/
+
+#include "helicsTypes.hpp"
+
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace helics {
+namespace detail {
+    /** marker for data written by a little endian machine*/
+    constexpr std::uint8_t codecLittleEndian{1};
+    /** marker for data written by a big endian machine*/
+    constexpr std::uint8_t codecBigEndian{0};
+    /** the type used to encode sizes of containers and strings*/
+    using codec_size_type = std::uint64_t;
+
+    /** get the marker for the endianness of the current machine*/
+    inline std::uint8_t nativeCodecMarker()
+    {
+        static const std::uint32_t test{1};
+        return (*reinterpret_cast<const std::uint8_t*>(&test) == 1) ? codecLittleEndian :
+                                                                     codecBigEndian;
+    }
+
+    /** check the format marker of encoded data
+    @param data pointer to the start of the encoded data
+    @param swap set to true if the data needs to be byte swapped
+    @return false if the marker is not a recognized layout*/
+    inline bool checkCodecMarker(const char* data, bool& swap)
+    {
+        auto marker = static_cast<std::uint8_t>(data[0]);
+        if (marker != codecLittleEndian && marker != codecBigEndian) {
+            return false;
+        }
+        swap = (marker != nativeCodecMarker());
+        return true;
+    }
+
+    /** reverse the bytes of a single value*/
+    template<std::size_t N>
+    inline void swapCodecBytes(char* data)
+    {
+        for (std::size_t ii = 0; ii < N / 2; ++ii) {
+            std::swap(data[ii], data[N - ii - 1]);
+        }
+    }
+
+    /** load a scalar value from a possibly unaligned location*/
+    template<class X>
+    inline X loadCodecScalar(const char* data, bool swap)
+    {
+        X val;
+        std::memcpy(&val, data, sizeof(X));
+        if (swap) {
+            swapCodecBytes<sizeof(X)>(reinterpret_cast<char*>(&val));
+        }
+        return val;
+    }
+
+    template<>
+    inline bool loadCodecScalar<bool>(const char* data, bool /*swap*/)
+    {
+        return (data[0] != 0);
+    }
+
+    /** load a series of elements of size N with optional byte swapping*/
+    template<std::size_t N>
+    inline void loadCodecArray(char* dest, const char* data, std::size_t count, bool swap)
+    {
+        std::memcpy(dest, data, count * N);
+        if (swap) {
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                swapCodecBytes<N>(dest + ii * N);
+            }
+        }
+    }
+
+    /** write a container size into a buffer*/
+    inline char* storeCodecSize(char* out, std::size_t size)
+    {
+        auto sz = static_cast<codec_size_type>(size);
+        std::memcpy(out, &sz, sizeof(codec_size_type));
+        return out + sizeof(codec_size_type);
+    }
+
+    /** read a container size from data and check that enough data remains for the elements*/
+    inline bool loadCodecSize(const char*& data,
+                              const char* end,
+                              std::size_t elementSize,
+                              bool swap,
+                              std::size_t& size)
+    {
+        if (end - data < static_cast<std::ptrdiff_t>(sizeof(codec_size_type))) {
+            return false;
+        }
+        auto sz = loadCodecScalar<codec_size_type>(data, swap);
+        data += sizeof(codec_size_type);
+        if (elementSize > 0 &&
+            sz > static_cast<codec_size_type>(end - data) /
+                    static_cast<codec_size_type>(elementSize)) {
+            return false;
+        }
+        size = static_cast<std::size_t>(sz);
+        return true;
+    }
+
+    /** codec for types without a fixed layout encoding*/
+    template<class X, typename = void>
+    struct FixedLayoutCodec {
+        static constexpr bool supported{false};
+    };
+
+    /** fixed layout codec for arithmetic types*/
+    template<class X>
+    struct FixedLayoutCodec<X, std::enable_if_t<std::is_arithmetic<X>::value>> {
+        static constexpr bool supported{true};
+        static std::size_t encodedSize(const X& /*val*/) { return 1 + sizeof(X); }
+        static void encode(const X& val, char* out)
+        {
+            out[0] = static_cast<char>(nativeCodecMarker());
+            std::memcpy(out + 1, &val, sizeof(X));
+        }
+        /** the encoded size of an array of values*/
+        static std::size_t encodedArraySize(std::size_t count)
+        {
+            return 1 + sizeof(codec_size_type) + count * sizeof(X);
+        }
+        /** encode an array of values in the same layout as a vector of values*/
+        static void encodeArray(const X* vals, std::size_t count, char* out)
+        {
+            out[0] = static_cast<char>(nativeCodecMarker());
+            out = storeCodecSize(out + 1, count);
+            if (count > 0) {
+                std::memcpy(out, vals, count * sizeof(X));
+            }
+        }
+        static bool decode(const char* data, std::size_t size, X& val)
+        {
+            bool swap{false};
+            if (size < 1 + sizeof(X) || !checkCodecMarker(data, swap)) {
+                return false;
+            }
+            val = loadCodecScalar<X>(data + 1, swap);
+            return true;
+        }
+    };
+
+    /** fixed layout codec for complex values*/
+    template<>
+    struct FixedLayoutCodec<std::complex<double>> {
+        static constexpr bool supported{true};
+        static std::size_t encodedSize(const std::complex<double>& /*val*/)
+        {
+            return 1 + 2 * sizeof(double);
+        }
+        static void encode(const std::complex<double>& val, char* out)
+        {
+            out[0] = static_cast<char>(nativeCodecMarker());
+            const double parts[2] = {val.real(), val.imag()};
+            std::memcpy(out + 1, parts, 2 * sizeof(double));
+        }
+        static std::size_t encodedArraySize(std::size_t count)
+        {
+            return 1 + sizeof(codec_size_type) + count * 2 * sizeof(double);
+        }
+        static void encodeArray(const std::complex<double>* vals, std::size_t count, char* out)
+        {
+            out[0] = static_cast<char>(nativeCodecMarker());
+            out = storeCodecSize(out + 1, count);
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                const double parts[2] = {vals[ii].real(), vals[ii].imag()};
+                std::memcpy(out, parts, 2 * sizeof(double));
+                out += 2 * sizeof(double);
+            }
+        }
+        static bool decode(const char* data, std::size_t size, std::complex<double>& val)
+        {
+            bool swap{false};
+            if (size < 1 + 2 * sizeof(double) || !checkCodecMarker(data, swap)) {
+                return false;
+            }
+            val = std::complex<double>(loadCodecScalar<double>(data + 1, swap),
+                                       loadCodecScalar<double>(data + 1 + sizeof(double), swap));
+            return true;
+        }
+    };
+
+    /** fixed layout codec for vectors of doubles and complex values*/
+    template<class X>
+    struct FixedLayoutCodec<
+        std::vector<X>,
+        std::enable_if_t<std::is_same<X, double>::value ||
+                         std::is_same<X, std::complex<double>>::value>> {
+        static constexpr bool supported{true};
+        /** the size of a single scalar in the encoding*/
+        static constexpr std::size_t scalarSize{sizeof(double)};
+        /** the number of scalars in each element*/
+        static constexpr std::size_t scalarCount{sizeof(X) / sizeof(double)};
+
+        static std::size_t encodedSize(const std::vector<X>& val)
+        {
+            return FixedLayoutCodec<X>::encodedArraySize(val.size());
+        }
+        static void encode(const std::vector<X>& val, char* out)
+        {
+            FixedLayoutCodec<X>::encodeArray(val.data(), val.size(), out);
+        }
+        static bool decode(const char* data, std::size_t size, std::vector<X>& val)
+        {
+            bool swap{false};
+            if (size < 1 + sizeof(codec_size_type) || !checkCodecMarker(data, swap)) {
+                return false;
+            }
+            const char* end = data + size;
+            ++data;
+            std::size_t count{0};
+            if (!loadCodecSize(data, end, sizeof(X), swap, count)) {
+                return false;
+            }
+            val.resize(count);
+            if (count > 0) {
+                // std::complex<double> is guaranteed to have the layout of double[2]
+                loadCodecArray<scalarSize>(
+                    reinterpret_cast<char*>(val.data()), data, count * scalarCount, swap);
+            }
+            return true;
+        }
+    };
+
+    /** fixed layout codec for named points*/
+    template<>
+    struct FixedLayoutCodec<NamedPoint> {
+        static constexpr bool supported{true};
+        static std::size_t encodedSize(const NamedPoint& val)
+        {
+            return 1 + sizeof(codec_size_type) + val.name.size() + sizeof(double);
+        }
+        static void encode(const NamedPoint& val, char* out)
+        {
+            out[0] = static_cast<char>(nativeCodecMarker());
+            out = storeCodecSize(out + 1, val.name.size());
+            if (!val.name.empty()) {
+                std::memcpy(out, val.name.data(), val.name.size());
+                out += val.name.size();
+            }
+            std::memcpy(out, &val.value, sizeof(double));
+        }
+        static bool decode(const char* data, std::size_t size, NamedPoint& val)
+        {
+            bool swap{false};
+            if (size < 1 + sizeof(codec_size_type) + sizeof(double) ||
+                !checkCodecMarker(data, swap)) {
+                return false;
+            }
+            const char* end = data + size;
+            ++data;
+            std::size_t length{0};
+            if (!loadCodecSize(data, end - sizeof(double), 1, swap, length)) {
+                return false;
+            }
+            val.name.assign(data, length);
+            val.value = loadCodecScalar<double>(data + length, swap);
+            return true;
+        }
+    };
+
+}  // namespace detail
+}  // namespace helics
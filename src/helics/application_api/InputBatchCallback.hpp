@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "Inputs.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/** @file
+@details statically typed callbacks for groups of inputs
+*/
+
+namespace helics {
+/** base class for delivering the updates of a group of inputs after a time request
+@details while processing the value updates from the core the federate records which inputs of
+the group were updated,  once all updates are processed the dispatcher is called a single time
+with the list of updated inputs
+*/
+class HELICS_CXX_EXPORT InputBatchDispatcher {
+  public:
+    explicit InputBatchDispatcher(std::vector<Input*> inputList): inputs(std::move(inputList)) {}
+    virtual ~InputBatchDispatcher() = default;
+    /** get the inputs handled by the dispatcher*/
+    const std::vector<Input*>& getInputs() const { return inputs; }
+    /** record that an input was updated
+    @param index the index of the input in the input list*/
+    void markUpdated(int index) { pending.push_back(index); }
+    /** check if there are updates that have not been dispatched*/
+    bool hasPending() const { return !pending.empty(); }
+    /** deliver the recorded updates and clear them*/
+    void dispatch(Time time)
+    {
+        deliver(pending, time);
+        pending.clear();
+    }
+
+  protected:
+    /** deliver the values of the updated inputs
+    @param updated the indices of the updated inputs in the input list
+    @param time the time of the updates*/
+    virtual void deliver(const std::vector<int>& updated, Time time) = 0;
+
+    std::vector<Input*> inputs;  //!< the inputs handled by the dispatcher
+
+  private:
+    std::vector<int> pending;  //!< the indices of the updated inputs
+    friend class ValueFederateManager;  // the manager replaces the inputs with its stored inputs
+};
+
+/** dispatcher calling a callable directly with the value of each updated input
+@tparam X the type to retrieve the values as
+@tparam Callback a callable with the signature void(Input&, const X&, Time)
+*/
+template<class X, class Callback>
+class TypedInputBatch final: public InputBatchDispatcher {
+  public:
+    TypedInputBatch(std::vector<Input*> inputList, Callback cb):
+        InputBatchDispatcher(std::move(inputList)), callback(std::move(cb))
+    {
+    }
+
+  private:
+    void deliver(const std::vector<int>& updated, Time time) override
+    {
+        for (auto index : updated) {
+            auto& inp = *inputs[index];
+            inp.getValue(value);
+            callback(inp, static_cast<const X&>(value), time);
+        }
+    }
+    Callback callback;  //!< the callable to deliver the values to
+    X value{};  //!< storage for the values reused for each input
+};
+
+/** register a statically typed callback for a group of inputs
+@details the callback is called with each updated input of the group once all the updates of a
+time request have been processed,  the value is retrieved as type X without going through
+std::function or the variant used by the callbacks of the individual inputs.  The inputs of the
+group no longer trigger their individual callbacks or the federate wide callback.
+@tparam X the type to retrieve the values as
+@param fed the federate the inputs belong to
+@param inputs the inputs to group
+@param callback a callable with the signature void(Input&, const X&, Time)
+*/
+template<class X, class Callback>
+void setInputBatchCallback(ValueFederate& fed, std::vector<Input*> inputs, Callback&& callback)
+{
+    using callback_type = std::decay_t<Callback>;
+    fed.registerInputBatch(std::make_unique<TypedInputBatch<X, callback_type>>(
+        std::move(inputs), std::forward<Callback>(callback)));
+}
+}  // namespace helics
@@ -12,7 +12,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "units/units/units.hpp"
 
 #include <algorithm>
+#include <complex>
+#include <cstddef>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -335,32 +338,6 @@ static defV minOperation(const std::vector<defV>& vals)
     }
 }
 
-static defV vectorSum(const std::vector<defV>& vals)
-{
-    double result{0.0};
-    for (const auto& v : vals) {
-        const auto& vect = mpark::get<std::vector<double>>(v);
-        for (const auto& el : vect) {
-            result += el;
-        }
-    }
-    return result;
-}
-
-static defV vectorAvg(const std::vector<defV>& vals)
-{
-    double result{0.0};
-    int N{0};
-    for (const auto& v : vals) {
-        const auto& vect = mpark::get<std::vector<double>>(v);
-        for (const auto& el : vect) {
-            result += el;
-            ++N;
-        }
-    }
-    return result / static_cast<double>(N);
-}
-
 static defV vectorDiff(const std::vector<defV>& vals)
 {
     std::vector<double> X;
@@ -377,39 +354,54 @@ static defV vectorDiff(const std::vector<defV>& vals)
     return X;
 }
 
+/** extract a value of a type which carries units and apply a unit conversion
+@return false if the type is not converted and nothing was extracted*/
+static bool extractAndConvert(defV& store,
+                              const data_view& dv,
+                              data_type type,
+                              const UnitConversionPlan& plan)
+{
+    switch (type) {
+        case data_type::helics_double:
+            store = doubleExtractAndConvert(dv, plan);
+            return true;
+        case data_type::helics_int:
+            integerExtractAndConvert(store, dv, plan);
+            return true;
+        case data_type::helics_vector: {
+            if (plan.isIdentity()) {
+                return false;
+            }
+            std::vector<double> vals;
+            valueExtract(dv, type, vals);
+            plan.apply(vals.data(), vals.size());
+            store = std::move(vals);
+            return true;
+        }
+        case data_type::helics_complex_vector: {
+            if (plan.isIdentity()) {
+                return false;
+            }
+            std::vector<std::complex<double>> vals;
+            valueExtract(dv, type, vals);
+            plan.apply(vals.data(), vals.size());
+            store = std::move(vals);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 static bool changeDetected(const defV& prevValue, const defV& newVal, double deltaV)
 {
     auto visitor = [&](const auto& arg) { return changeDetected(prevValue, arg, deltaV); };
     return mpark::visit(visitor, newVal);
 }
 
-bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const data_block>>& dataV)
+/** get the type the values of all the sources are converted to for a multi-input reduction*/
+static data_type reductionType(multi_input_handling_method inputVectorOp, data_type targetType)
 {
-    if (injectionType == data_type::helics_unknown ||
-        static_cast<int32_t>(dataV.size()) != prevInputCount) {
-        loadSourceInformation();
-        prevInputCount = static_cast<int32_t>(dataV.size());
-    }
-    std::vector<defV> res;
-    res.reserve(dataV.size());
-    for (size_t ii = 0; ii < dataV.size(); ++ii) {
-        if (dataV[ii]) {
-            auto localTargetType = (injectionType == helics::data_type::helics_multi) ?
-                sourceTypes[ii].first :
-                injectionType;
-
-            const auto& localUnits = (multiUnits) ? sourceTypes[ii].second : inputUnits;
-            if (localTargetType == helics::data_type::helics_double) {
-                res.emplace_back(doubleExtractAndConvert(*dataV[ii], localUnits, outputUnits));
-            } else if (localTargetType == helics::data_type::helics_int) {
-                res.emplace_back();
-                integerExtractAndConvert(res.back(), *dataV[ii], localUnits, outputUnits);
-            } else {
-                res.emplace_back();
-                valueExtract(*dataV[ii], localTargetType, res.back());
-            }
-        }
-    }
     data_type type = data_type::helics_multi;
     switch (inputVectorOp) {
         case multi_input_handling_method::and_operation:
@@ -439,21 +431,114 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const data_block
                 (targetType == data_type::helics_unknown) ? data_type::helics_double : targetType;
             break;
     }
-    // convert everything to a uniform type
-    for (auto& ival : res) {
-        valueConvert(ival, type);
+    return type;
+}
+
+/** copy the elements of the updated sources into their locations in a vectorized result*/
+template<class T>
+static void updateVectorized(defV& result,
+                             const std::vector<defV>& values,
+                             const std::vector<std::size_t>& offsets,
+                             const std::vector<std::size_t>& touched)
+{
+    auto& res = mpark::get<std::vector<T>>(result);
+    for (auto index : touched) {
+        const auto& v = mpark::get<std::vector<T>>(values[index]);
+        std::copy(v.begin(), v.end(), res.begin() + static_cast<std::ptrdiff_t>(offsets[index]));
+    }
+}
+
+bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const data_block>>& dataV)
+{
+    if (injectionType == data_type::helics_unknown ||
+        static_cast<int32_t>(dataV.size()) != prevInputCount) {
+        loadSourceInformation();
+        prevInputCount = static_cast<int32_t>(dataV.size());
+    }
+    const data_type type = reductionType(inputVectorOp, targetType);
+    auto& cache = multiCache;
+    // the sizes or locations of the values in a vectorized result changed
+    bool layoutChanged{!cache.vectorizedValid};
+    if (cache.sourceData.size() != dataV.size()) {
+        cache = multiInputCache{};
+        cache.sourceData.resize(dataV.size());
+        cache.values.resize(dataV.size());
+        cache.sums.resize(dataV.size(), 0.0);
+        cache.counts.resize(dataV.size(), 0);
+        layoutChanged = true;
+    }
+    cache.touched.clear();
+    std::size_t presentCount{0};
+    for (size_t ii = 0; ii < dataV.size(); ++ii) {
+        // data blocks are immutable so a source only needs processing if its block was replaced
+        if (dataV[ii] == cache.sourceData[ii]) {
+            if (dataV[ii]) {
+                ++presentCount;
+            }
+            continue;
+        }
+        if (!dataV[ii] || !cache.sourceData[ii]) {
+            layoutChanged = true;
+        }
+        cache.sourceData[ii] = dataV[ii];
+        auto& val = cache.values[ii];
+        if (!dataV[ii]) {
+            val = defV{};
+            cache.sums[ii] = 0.0;
+            cache.counts[ii] = 0;
+            continue;
+        }
+        ++presentCount;
+        auto localTargetType = (injectionType == helics::data_type::helics_multi) ?
+            sourceTypes[ii].first :
+            injectionType;
+
+        const auto& localPlan = (multiUnits) ? sourceTypes[ii].second : conversionPlan;
+        if (!extractAndConvert(val, *dataV[ii], localTargetType, localPlan)) {
+            valueExtract(*dataV[ii], localTargetType, val);
+        }
+        // convert everything to a uniform type
+        valueConvert(val, type);
+        std::size_t count{0};
+        if (type == data_type::helics_vector) {
+            const auto& vect = mpark::get<std::vector<double>>(val);
+            cache.sums[ii] = std::accumulate(vect.begin(), vect.end(), 0.0);
+            count = vect.size();
+        } else if (type == data_type::helics_complex_vector) {
+            count = mpark::get<std::vector<std::complex<double>>>(val).size();
+        }
+        if (count != cache.counts[ii]) {
+            layoutChanged = true;
+            cache.counts[ii] = count;
+        }
+        cache.touched.push_back(ii);
     }
+    // the reductions which look at the values need them without the sources that have no data
+    auto presentValues = [&cache, presentCount]() -> const std::vector<defV>& {
+        if (presentCount == cache.values.size()) {
+            return cache.values;
+        }
+        cache.present.clear();
+        for (size_t ii = 0; ii < cache.values.size(); ++ii) {
+            if (cache.sourceData[ii]) {
+                cache.present.push_back(cache.values[ii]);
+            }
+        }
+        return cache.present;
+    };
+
     defV result;
     switch (inputVectorOp) {
         case multi_input_handling_method::max_operation:
-            result = maxOperation(res);
+            result = maxOperation(presentValues());
             break;
         case multi_input_handling_method::min_operation:
-            result = minOperation(res);
+            result = minOperation(presentValues());
             break;
-        case multi_input_handling_method::and_operation:
-            result = std::all_of(res.begin(),
-                                 res.end(),
+        case multi_input_handling_method::and_operation: {
+            const auto& vals = presentValues();
+            result = std::all_of(vals.begin(),
+                                 vals.end(),
                                  [](auto& val) {
                                      bool boolResult;
                                      valueExtract(val, boolResult);
@@ -461,10 +546,11 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const data_block
                                  }) ?
                 "1" :
                 "0";
-            break;
-        case multi_input_handling_method::or_operation:
-            result = std::any_of(res.begin(),
-                                 res.end(),
+        } break;
+        case multi_input_handling_method::or_operation: {
+            const auto& vals = presentValues();
+            result = std::any_of(vals.begin(),
+                                 vals.end(),
                                  [](auto& val) {
                                      bool boolResult;
                                      valueExtract(val, boolResult);
@@ -472,22 +558,41 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const data_block
                                  }) ?
                 "1" :
                 "0";
-            break;
+        } break;
         case multi_input_handling_method::sum_operation:
-            result = vectorSum(res);
+            // the sources without data have a sum of 0
+            result = std::accumulate(cache.sums.begin(), cache.sums.end(), 0.0);
             break;
         case multi_input_handling_method::average_operation:
-            result = vectorAvg(res);
+            result = std::accumulate(cache.sums.begin(), cache.sums.end(), 0.0) /
+                static_cast<double>(
+                         std::accumulate(cache.counts.begin(), cache.counts.end(), std::size_t{0}));
             break;
         case multi_input_handling_method::diff_operation:
             if (type == data_type::helics_vector) {
-                result = vectorDiff(res);
+                result = vectorDiff(presentValues());
             } else {
-                result = diffOperation(res);
+                result = diffOperation(presentValues());
             }
             break;
         case multi_input_handling_method::vectorize_operation:
-            result = vectorizeOperation(res);
+            if (type == data_type::helics_string || layoutChanged) {
+                cache.vectorized = vectorizeOperation(presentValues());
+                cache.offsets.assign(cache.counts.size(), 0);
+                std::size_t offset{0};
+                for (size_t ii = 0; ii < cache.counts.size(); ++ii) {
+                    cache.offsets[ii] = offset;
+                    offset += cache.counts[ii];
+                }
+                cache.vectorizedValid = (type != data_type::helics_string);
+            } else if (type == data_type::helics_complex_vector) {
+                updateVectorized<std::complex<double>>(
+                    cache.vectorized, cache.values, cache.offsets, cache.touched);
+            } else {
+                updateVectorized<double>(
+                    cache.vectorized, cache.values, cache.offsets, cache.touched);
+            }
+            result = cache.vectorized;
             break;
         default:
             break;
@@ -517,12 +622,8 @@ bool Input::checkUpdate(bool assumeUpdate)
             auto visitor = [&, this](auto&& arg) {
                 std::remove_reference_t<decltype(arg)> newVal;
                 (void)arg;  // suppress VS2015 warning
-                if (injectionType == helics::data_type::helics_double) {
-                    defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-                    valueExtract(val, newVal);
-                } else if (injectionType == helics::data_type::helics_int) {
-                    defV val;
-                    integerExtractAndConvert(val, dv, inputUnits, outputUnits);
+                defV val;
+                if (convertedExtract(dv, val)) {
                     valueExtract(val, newVal);
                 } else {
                     valueExtract(dv, injectionType, newVal);
@@ -545,6 +646,7 @@ void Input::setOption(int32_t option, int32_t value)
 {
     if (option == helics_handle_option_multi_input_handling_method) {
         inputVectorOp = static_cast<multi_input_handling_method>(value);
+        multiCache = multiInputCache{};
     } else {
         fed->setInterfaceOption(handle, option, value);
     }
@@ -656,6 +758,41 @@ size_t Input::getVectorSize()
     return out.size();
 }
 
+template<class T>
+VectorView<T> Input::getVectorViewImpl()
+{
+    if (fed->isUpdated(*this) || allowDirectFederateUpdate()) {
+        if (injectionType == data_type::helics_unknown) {
+            loadSourceInformation();
+        }
+        // a unit conversion needs a converted copy so the view cannot read the received data
+        if (!changeDetectionEnabled && inputVectorOp == multi_input_handling_method::no_op &&
+            conversionPlan.isIdentity() &&
+            (injectionType == data_type::helics_vector ||
+             injectionType == data_type::helics_complex_vector)) {
+            VectorView<T> view(fed->getValueRaw(*this), injectionType);
+            // the value is still only held in the received data so any other retrieval
+            // needs to extract it from there
+            viewPending = true;
+            if (view.valid()) {
+                hasUpdate = false;
+                return view;
+            }
+        }
+    }
+    return VectorView<T>(getValue<std::vector<T>>());
+}
+
+VectorView<double> Input::getVectorView()
+{
+    return getVectorViewImpl<double>();
+}
+
+VectorView<std::complex<double>> Input::getComplexVectorView()
+{
+    return getVectorViewImpl<std::complex<double>>();
+}
+
 void Input::loadSourceInformation()
 {
     if (targetType == data_type::helics_unknown) {
@@ -670,11 +807,11 @@ void Input::loadSourceInformation()
         if (injectionType == data_type::helics_multi) {
             auto jvalue = loadJsonStr(iType);
             for (auto& res : jvalue) {
-                sourceTypes.emplace_back(getTypeFromString(res.asCString()), nullptr);
+                sourceTypes.emplace_back(getTypeFromString(res.asCString()), UnitConversionPlan());
             }
         } else {
             auto iValue = loadJsonStr(iUnits);
-            sourceTypes.resize(iValue.size(), {injectionType, nullptr});
+            sourceTypes.resize(iValue.size(), {injectionType, UnitConversionPlan()});
         }
         if (!iUnits.empty()) {
             if (iUnits.front() == '[') {
@@ -687,7 +824,7 @@ void Input::loadSourceInformation()
                         auto U =
                             std::make_shared<units::precise_unit>(units::unit_from_string(str));
                         if (units::is_valid(*U)) {
-                            sourceTypes[ii].second = std::move(U);
+                            sourceTypes[ii].second = UnitConversionPlan(U, outputUnits);
                         }
                     }
                     ++ii;
@@ -697,8 +834,9 @@ void Input::loadSourceInformation()
                 if (!units::is_valid(*inputUnits)) {
                     inputUnits.reset();
                 } else {
+                    UnitConversionPlan plan(inputUnits, outputUnits);
                     for (auto& src : sourceTypes) {
-                        src.second = inputUnits;
+                        src.second = plan;
                     }
                 }
             }
@@ -712,6 +850,15 @@ void Input::loadSourceInformation()
             }
         }
     }
+    // the units are fixed until the sources change so the conversion is only computed here
+    conversionPlan = UnitConversionPlan(inputUnits, outputUnits);
+    // the cached values of a multi-input reduction depend on the source types and units
+    multiCache = multiInputCache{};
+}
+
+bool Input::convertedExtract(const data_view& dv, defV& store) const
+{
+    return extractAndConvert(store, dv, injectionType, conversionPlan);
 }
 
 double doubleExtractAndConvert(const data_view& dv,
@@ -738,6 +885,21 @@ void integerExtractAndConvert(defV& store,
     }
 }
 
+double doubleExtractAndConvert(const data_view& dv, const UnitConversionPlan& plan)
+{
+    return plan.apply(ValueConverter<double>::interpret(dv));
+}
+
+void integerExtractAndConvert(defV& store, const data_view& dv, const UnitConversionPlan& plan)
+{
+    auto V = ValueConverter<int64_t>::interpret(dv);
+    if (!plan.isIdentity()) {
+        store = plan.apply(static_cast<double>(V));
+    } else {
+        store = V;
+    }
+}
+
 char Input::getValueChar()
 {
     if (fed->isUpdated(*this) || allowDirectFederateUpdate()) {
@@ -761,7 +923,7 @@ char Input::getValueChar()
         } else {
             int64_t out = invalidValue<int64_t>();
             if (injectionType == helics::data_type::helics_double) {
-                out = static_cast<int64_t>(doubleExtractAndConvert(dv, inputUnits, outputUnits));
+                out = static_cast<int64_t>(doubleExtractAndConvert(dv, conversionPlan));
             } else {
                 valueExtract(dv, injectionType, out);
             }
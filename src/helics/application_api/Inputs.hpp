@@ -7,7 +7,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "HelicsPrimaryTypes.hpp"
+#include "UnitConversionPlan.hpp"
 #include "ValueFederate.hpp"
+#include "VectorView.hpp"
 #include "helicsTypes.hpp"
 
 #include <memory>
@@ -47,6 +49,7 @@ class HELICS_CXX_EXPORT Input {
         data_type::helics_unknown};  //!< the type of data coming from the publication
     bool changeDetectionEnabled{false};  //!< the change detection is enabled
     bool hasUpdate{false};  //!< the value has been updated
+    bool viewPending{false};  //!< the current value was read through a view and not yet extracted
     bool disableAssign{false};  //!< disable assignment for the object
     bool useThreshold{false};  //!< flag to indicate use a threshold for binary output
     bool multiUnits{false};  //!< flag indicating there are multiple Input Units
@@ -57,8 +60,25 @@ class HELICS_CXX_EXPORT Input {
     defV lastValue{invalidDouble};  //!< the last value updated
     std::shared_ptr<units::precise_unit> outputUnits;  //!< the target output units
     std::shared_ptr<units::precise_unit> inputUnits;  //!< the units of the linked publications
-    std::vector<std::pair<data_type, std::shared_ptr<units::precise_unit>>>
-        sourceTypes;  //!< source information for input sources
+    /// the conversion from the units of the linked publications to the output units
+    UnitConversionPlan conversionPlan;
+    std::vector<std::pair<data_type, UnitConversionPlan>>
+        sourceTypes;  //!< source type and unit conversion for input sources
+    /** per source state of a multi-input reduction so only the sources which updated are
+    extracted again*/
+    struct multiInputCache {
+        /// the data each cached value was extracted from,  empty if the source has no data
+        std::vector<std::shared_ptr<const data_block>> sourceData;
+        std::vector<defV> values;  //!< the extracted value of each source in the reduction type
+        std::vector<double> sums;  //!< the sum of the elements of each source
+        std::vector<std::size_t> counts;  //!< the number of elements of each source
+        std::vector<std::size_t> offsets;  //!< the location of each source in a vectorized result
+        std::vector<std::size_t> touched;  //!< the sources updated in the current step
+        std::vector<defV> present;  //!< storage for the values if some sources have no data
+        defV vectorized;  //!< the current vectorized result
+        bool vectorizedValid{false};  //!< indicator that the vectorized result can be updated
+    };
+    multiInputCache multiCache;  //!< state of the multi-input reduction
     double delta{-1.0};  //!< the minimum difference
     double threshold{0.0};  //!< the threshold to use for binary decisions
     std::string actualName;  //!< the name of the Input
@@ -425,6 +445,15 @@ class HELICS_CXX_EXPORT Input {
     size_t getStringSize();
     /** get the number of elements in the data if it were a vector*/
     size_t getVectorSize();
+    /** get a read only view of the current value as a vector of doubles
+    @details if the publication sends vectors the view reads directly from the received data
+    otherwise the value is converted,  complex vectors are viewed as interleaved real and imaginary
+    parts*/
+    VectorView<double> getVectorView();
+    /** get a read only view of the current value as a vector of complex values
+    @details if the publication sends complex vectors the view reads directly from the received
+    data otherwise the value is converted*/
+    VectorView<std::complex<double>> getComplexVectorView();
     /** close a input during an active simulation
     @details it is not necessary to call this function unless you are continuing the simulation
     after the close*/
@@ -442,12 +471,18 @@ class HELICS_CXX_EXPORT Input {
   private:
     /** load some information about the data source such as type and units*/
     void loadSourceInformation();
+    /** extract a value which carries units and apply the unit conversion
+    @return false if the injection type does not need a conversion and nothing was extracted*/
+    bool convertedExtract(const data_view& dv, defV& store) const;
     /** helper class for getting a character since that is a bit odd*/
     char getValueChar();
+    /** helper for generating vector views*/
+    template<class T>
+    VectorView<T> getVectorViewImpl();
     /** check if updates from the federate are allowed*/
     bool allowDirectFederateUpdate() const
     {
-        return hasUpdate && !changeDetectionEnabled &&
+        return (hasUpdate || viewPending) && !changeDetectionEnabled &&
             inputVectorOp == multi_input_handling_method::no_op;
     }
     friend class ValueFederateManager;
@@ -465,6 +500,15 @@ HELICS_CXX_EXPORT void
                              const std::shared_ptr<units::precise_unit>& inputUnits,
                              const std::shared_ptr<units::precise_unit>& outputUnits);
 
+/** convert a dataview to a double and apply a precomputed unit conversion*/
+HELICS_CXX_EXPORT double doubleExtractAndConvert(const data_view& dv,
+                                                 const UnitConversionPlan& plan);
+
+/** convert a dataview to an integer and apply a precomputed unit conversion,  the value is stored
+as a double if a conversion is applied*/
+HELICS_CXX_EXPORT void
+    integerExtractAndConvert(defV& store, const data_view& dv, const UnitConversionPlan& plan);
+
 /** class to handle an input and extract a specific type
 @tparam X the class of the value associated with a input*/
 template<class X>
@@ -547,12 +591,8 @@ void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out
             loadSourceInformation();
         }
 
-        if (injectionType == helics::data_type::helics_double) {
-            defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-            valueExtract(val, out);
-        } else if (injectionType == helics::data_type::helics_int) {
-            defV val;
-            integerExtractAndConvert(val, dv, inputUnits, outputUnits);
+        defV val;
+        if (convertedExtract(dv, val)) {
             valueExtract(val, out);
         } else {
             valueExtract(dv, injectionType, out);
@@ -570,6 +610,7 @@ void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out
         valueExtract(lastValue, out);
     }
     hasUpdate = false;
+    viewPending = false;
 }
 
 template<class X>
@@ -603,12 +644,8 @@ const X& Input::getValueRef()
 
         if (changeDetectionEnabled) {
             X out;
-            if (injectionType == helics::data_type::helics_double) {
-                defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-                valueExtract(val, out);
-            } else if (injectionType == helics::data_type::helics_int) {
-                defV val;
-                integerExtractAndConvert(val, dv, inputUnits, outputUnits);
+            defV val;
+            if (convertedExtract(dv, val)) {
                 valueExtract(val, out);
             } else {
                 valueExtract(dv, injectionType, out);
@@ -616,9 +653,10 @@ const X& Input::getValueRef()
             if (changeDetected(lastValue, out, delta)) {
                 lastValue = make_valid(std::move(out));
             }
-        } else {
+        } else if (!convertedExtract(dv, lastValue)) {
             valueExtract(dv, injectionType, lastValue);
         }
+        viewPending = false;
     } else {
         // TODO(PT): make some logic that it can get the raw data from the core again if it was
         // converted already
@@ -284,6 +284,23 @@ std::unique_ptr<Message> MessageFederate::getMessage(const Endpoint& ept)
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Message>> MessageFederate::receiveBatch(const Endpoint& ept,
+                                                                   int maxCount)
+{
+    if (currentMode >= modes::initializing) {
+        return mfManager->receiveBatch(ept, maxCount);
+    }
+    return {};
+}
+
+std::vector<std::unique_ptr<Message>> MessageFederate::receiveBatch(int maxCount)
+{
+    if (currentMode >= modes::initializing) {
+        return mfManager->receiveBatch(maxCount);
+    }
+    return {};
+}
+
 void MessageFederate::sendMessage(const Endpoint& source,
                                   const std::string& dest,
                                   const data_view& message)
@@ -309,6 +326,31 @@ void MessageFederate::sendMessage(const Endpoint& source,
     }
 }
 
+int32_t MessageFederate::registerDestination(const std::string& dest)
+{
+    return mfManager->registerDestination(dest);
+}
+
+void MessageFederate::sendMessage(const Endpoint& source,
+                                  int32_t destination,
+                                  const data_view& message)
+{
+    sendMessage(source, destination, message, Time::minVal());
+}
+
+void MessageFederate::sendMessage(const Endpoint& source,
+                                  int32_t destination,
+                                  const data_view& message,
+                                  Time sendTime)
+{
+    if ((currentMode == modes::executing) || (currentMode == modes::initializing)) {
+        mfManager->sendMessage(source, destination, message, sendTime);
+    } else {
+        throw(InvalidFunctionCall(
+            "messages not allowed outside of execution and initialization mode"));
+    }
+}
+
 void MessageFederate::sendMessage(const Endpoint& source, std::unique_ptr<Message> message)
 {
     if ((currentMode == modes::executing) || (currentMode == modes::initializing)) {
@@ -329,6 +371,32 @@ void MessageFederate::sendMessage(const Endpoint& source, const Message& message
     }
 }
 
+void MessageFederate::sendBatch(const Endpoint& source,
+                                const std::vector<std::string>& destinations,
+                                const std::vector<data_view>& messages)
+{
+    sendBatch(source, destinations, messages, Time::minVal());
+}
+
+void MessageFederate::sendBatch(const Endpoint& source,
+                                const std::vector<std::string>& destinations,
+                                const std::vector<data_view>& messages,
+                                Time sendTime)
+{
+    if ((currentMode != modes::executing) && (currentMode != modes::initializing)) {
+        throw(InvalidFunctionCall(
+            "messages not allowed outside of execution and initialization mode"));
+    }
+    if (destinations.empty() || messages.empty()) {
+        return;
+    }
+    if (destinations.size() != messages.size() && destinations.size() != 1 &&
+        messages.size() != 1) {
+        throw(InvalidParameter("the number of destinations does not match the number of messages"));
+    }
+    mfManager->sendBatch(source, destinations, messages, sendTime);
+}
+
 Endpoint& MessageFederate::getEndpoint(const std::string& eptName) const
 {
     auto& id = mfManager->getEndpoint(eptName);
@@ -371,4 +439,10 @@ void MessageFederate::addDestinationFilter(const Endpoint& ept, const std::strin
     mfManager->addDestinationFilter(ept, filterName);
 }
 
+void MessageFederate::setEndpointOption(const Endpoint& ept, int32_t option, int32_t value)
+{
+    mfManager->setQueueOption(ept, option, value);
+    setInterfaceOption(ept.getHandle(), option, value);
+}
+
 }  // namespace helics
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace helics {
 class MessageFederateManager;
@@ -179,6 +180,17 @@ class HELICS_CXX_EXPORT MessageFederate:
     all messages for the first endpoint, then all for the second, and so on
     @return a unique_ptr to a Message object containing the message data*/
     std::unique_ptr<Message> getMessage();
+    /** receive several messages from a particular endpoint
+    @details the messages are removed from the endpoint queue with a single lock
+    @param ept the endpoint to receive the messages from
+    @param maxCount the maximum number of messages to return
+    @return a vector of up to maxCount messages in order of arrival*/
+    std::vector<std::unique_ptr<Message>> receiveBatch(const Endpoint& ept, int maxCount);
+    /** receive several messages for any endpoint in the federate
+    @details the messages are returned in the same order as repeated calls to getMessage()
+    @param maxCount the maximum number of messages to return
+    @return a vector of up to maxCount messages*/
+    std::vector<std::unique_ptr<Message>> receiveBatch(int maxCount);
 
     /** send a message
     @details send a message to a specific destination
@@ -228,6 +240,28 @@ class HELICS_CXX_EXPORT MessageFederate:
                      const std::string& dest,
                      const data_view& message,
                      Time sendTime);
+    /** get an identifier for a named destination
+    @details messages sent to the identifier are addressed by handle once the core has located the
+    destination so repeated sends skip the processing of the name
+    @param dest the name of the destination endpoint
+    @return an identifier to use with sendMessage*/
+    int32_t registerDestination(const std::string& dest);
+    /** send a message to a registered destination
+    @param source the source endpoint
+    @param destination an identifier returned by registerDestination
+    @param message a data_view of the message
+    */
+    void sendMessage(const Endpoint& source, int32_t destination, const data_view& message);
+    /** send an event message to a registered destination at a particular time
+    @param source the source endpoint
+    @param destination an identifier returned by registerDestination
+    @param message a data_view of the message data to send
+    @param sendTime the time the message should be sent
+    */
+    void sendMessage(const Endpoint& source,
+                     int32_t destination,
+                     const data_view& message,
+                     Time sendTime);
     /** send an event message at a particular time
     @details send a message to a specific destination
     @param source the source endpoint
@@ -242,6 +276,31 @@ class HELICS_CXX_EXPORT MessageFederate:
     */
     void sendMessage(const Endpoint& source, const Message& message);
 
+    /** send a batch of messages from an endpoint
+    @details the messages are handed to the core in a single call which queues them as a few
+    large commands instead of one command per message
+    @param source the source endpoint
+    @param destinations the destinations of the messages,  a single destination is used for all
+    the messages
+    @param messages the data of the messages,  a single message is sent to all the destinations
+    @throw InvalidParameter if the number of destinations and messages do not match and neither
+    is 1
+    */
+    void sendBatch(const Endpoint& source,
+                   const std::vector<std::string>& destinations,
+                   const std::vector<data_view>& messages);
+    /** send a batch of event messages at a particular time
+    @param source the source endpoint
+    @param destinations the destinations of the messages,  a single destination is used for all
+    the messages
+    @param messages the data of the messages,  a single message is sent to all the destinations
+    @param sendTime the time the messages should be sent
+    */
+    void sendBatch(const Endpoint& source,
+                   const std::vector<std::string>& destinations,
+                   const std::vector<data_view>& messages,
+                   Time sendTime);
+
     /** get an endpoint by its name
     @param name the Endpoint
     @return an Endpoint*/
@@ -267,6 +326,13 @@ class HELICS_CXX_EXPORT MessageFederate:
     void addSourceFilter(const Endpoint& ept, const std::string& filterName);
     /** add a named filter to an endpoint for all message going to the endpoint*/
     void addDestinationFilter(const Endpoint& ept, const std::string& filterName);
+    /** set an option on an endpoint
+    @details the receive queue capacity and overflow policy options apply to the queue in the
+    federate as well as the queue in the core
+    @param ept the endpoint to set the option for
+    @param option the option to set see \ref helics_handle_options
+    @param value the value of the option*/
+    void setEndpointOption(const Endpoint& ept, int32_t option, int32_t value);
 
     virtual void disconnect() override;
 
@@ -6,12 +6,17 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "MessageFederateManager.hpp"
 
+#include "../common/JsonProcessingFunctions.hpp"
 #include "../core/Core.hpp"
+#include "../core/helics_definitions.hpp"
 #include "../core/queryHelpers.hpp"
 #include "helics/core/core-exceptions.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <string>
+#include <utility>
 
 namespace helics {
 MessageFederateManager::MessageFederateManager(Core* coreOb,
@@ -74,7 +79,7 @@ bool MessageFederateManager::hasMessage() const
 {
     auto eptDat = eptData.lock_shared();
     for (const auto& mq : eptDat) {
-        if (!mq->messages.empty()) {
+        if (!mq->messages.lock()->empty()) {
             return true;
         }
     }
@@ -85,7 +90,7 @@ bool MessageFederateManager::hasMessage(const Endpoint& ept)
 {
     if (ept.dataReference != nullptr) {
         auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
-        return (!eptDat->messages.empty());
+        return (!eptDat->messages.lock()->empty());
     }
     return false;
 }
@@ -97,7 +102,7 @@ uint64_t MessageFederateManager::pendingMessages(const Endpoint& ept)
 {
     if (ept.dataReference != nullptr) {
         auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
-        return eptDat->messages.size();
+        return eptDat->messages.lock()->size();
     }
     return 0;
 }
@@ -111,7 +116,7 @@ uint64_t MessageFederateManager::pendingMessages() const
     auto eptDat = eptData.lock_shared();
     uint64_t sz = 0;
     for (const auto& mq : eptDat) {
-        sz += mq->messages.size();
+        sz += mq->messages.lock()->size();
     }
     return sz;
 }
@@ -120,9 +125,11 @@ std::unique_ptr<Message> MessageFederateManager::getMessage(const Endpoint& ept)
 {
     if (ept.dataReference != nullptr) {
         auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
-        auto mv = eptDat->messages.pop();
-        if (mv) {
-            return std::move(*mv);
+        auto queue = eptDat->messages.lock();
+        if (!queue->empty()) {
+            auto mv = std::move(queue->front());
+            queue->pop_front();
+            return mv;
         }
     }
     return nullptr;
@@ -133,16 +140,58 @@ std::unique_ptr<Message> MessageFederateManager::getMessage()
     // just start with the first endpoint and check until a queue isn't empty
     auto eptDat = eptData.lock();
     for (auto& edat : eptDat) {
-        if (!edat->messages.empty()) {
-            auto ms = edat->messages.pop();
-            if (ms) {
-                return std::move(*ms);
-            }
+        auto queue = edat->messages.lock();
+        if (!queue->empty()) {
+            auto ms = std::move(queue->front());
+            queue->pop_front();
+            return ms;
         }
     }
     return nullptr;
 }
 
+/** move up to maxCount messages from the front of a queue into the output vector*/
+static void drainMessages(std::deque<std::unique_ptr<Message>>& queue,
+                          std::vector<std::unique_ptr<Message>>& output,
+                          std::size_t maxCount)
+{
+    auto cnt = std::min(maxCount, queue.size());
+    auto last = queue.begin() + static_cast<std::ptrdiff_t>(cnt);
+    output.insert(output.end(),
+                  std::make_move_iterator(queue.begin()),
+                  std::make_move_iterator(last));
+    queue.erase(queue.begin(), last);
+}
+
+std::vector<std::unique_ptr<Message>> MessageFederateManager::receiveBatch(const Endpoint& ept,
+                                                                          int maxCount)
+{
+    std::vector<std::unique_ptr<Message>> batch;
+    if (ept.dataReference != nullptr && maxCount > 0) {
+        auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
+        auto queue = eptDat->messages.lock();
+        drainMessages(*queue, batch, static_cast<std::size_t>(maxCount));
+    }
+    return batch;
+}
+
+std::vector<std::unique_ptr<Message>> MessageFederateManager::receiveBatch(int maxCount)
+{
+    std::vector<std::unique_ptr<Message>> batch;
+    if (maxCount <= 0) {
+        return batch;
+    }
+    auto eptDat = eptData.lock();
+    for (auto& edat : eptDat) {
+        auto queue = edat->messages.lock();
+        drainMessages(*queue, batch, static_cast<std::size_t>(maxCount) - batch.size());
+        if (batch.size() >= static_cast<std::size_t>(maxCount)) {
+            break;
+        }
+    }
+    return batch;
+}
+
 void MessageFederateManager::sendMessage(const Endpoint& source,
                                          const std::string& dest,
                                          const data_view& message)
@@ -158,11 +207,69 @@ void MessageFederateManager::sendMessage(const Endpoint& source,
     coreObject->sendEvent(sendTime, source.handle, dest, message.data(), message.size());
 }
 
+int32_t MessageFederateManager::registerDestination(const std::string& dest)
+{
+    return coreObject->registerDestination(dest);
+}
+
+void MessageFederateManager::sendMessage(const Endpoint& source,
+                                         int32_t destination,
+                                         const data_view& message,
+                                         Time sendTime)
+{
+    coreObject->sendToDestination(sendTime,
+                                  source.handle,
+                                  destination,
+                                  message.data(),
+                                  message.size());
+}
+
 void MessageFederateManager::sendMessage(const Endpoint& source, std::unique_ptr<Message> message)
 {
     coreObject->sendMessage(source.handle, std::move(message));
 }
 
+void MessageFederateManager::sendBatch(const Endpoint& source,
+                                       const std::vector<std::string>& destinations,
+                                       const std::vector<data_view>& messages,
+                                       Time sendTime)
+{
+    // a single message is sent to all the destinations,  otherwise a single destination gets all
+    // the messages or the two are paired up
+    auto count = std::max(destinations.size(), messages.size());
+    std::vector<const char*> data(count);
+    std::vector<uint64_t> lengths(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        const auto& msg = (messages.size() == 1) ? messages.front() : messages[ii];
+        data[ii] = msg.data();
+        lengths[ii] = msg.size();
+    }
+    coreObject->sendBatch(sendTime,
+                          source.handle,
+                          destinations.data(),
+                          static_cast<int>(destinations.size()),
+                          data.data(),
+                          lengths.data(),
+                          static_cast<int>(count));
+}
+
+void MessageFederateManager::EndpointData::addMessage(std::unique_ptr<Message> message)
+{
+    auto limit = capacity.load();
+    auto queue = messages.lock();
+    if (limit > 0 && queue->size() >= static_cast<std::size_t>(limit)) {
+        if (overflowPolicy.load() == defs::queue_overflow::drop_newest) {
+            ++dropped;
+            return;
+        }
+        while (queue->size() >= static_cast<std::size_t>(limit)) {
+            queue->pop_front();
+            ++dropped;
+        }
+    }
+    queue->push_back(std::move(message));
+}
+
 void MessageFederateManager::updateTime(Time newTime, Time /*oldTime*/)
 {
     CurrentTime = newTime;
@@ -186,7 +293,7 @@ void MessageFederateManager::updateTime(Time newTime, Time /*oldTime*/)
 
             Endpoint& currentEpt = *fid;
             auto localEndpointIndex = fid->referenceIndex;
-            (*eptDat)[localEndpointIndex]->messages.emplace(std::move(message));
+            (*eptDat)[localEndpointIndex]->addMessage(std::move(message));
 
             if ((*eptDat)[localEndpointIndex]->callback) {
                 // need to be copied otherwise there is a potential race condition on lock removal
@@ -207,6 +314,24 @@ void MessageFederateManager::updateTime(Time newTime, Time /*oldTime*/)
     }
 }
 
+bool MessageFederateManager::setQueueOption(const Endpoint& ept, int32_t option, int32_t value)
+{
+    if (option != defs::options::receive_queue_capacity &&
+        option != defs::options::receive_queue_overflow_policy) {
+        return false;
+    }
+    if (ept.dataReference == nullptr) {
+        return true;
+    }
+    auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
+    if (option == defs::options::receive_queue_capacity) {
+        eptDat->capacity = (value > 0) ? value : 0;
+    } else {
+        eptDat->overflowPolicy = value;
+    }
+    return true;
+}
+
 void MessageFederateManager::startupToInitializeStateTransition() {}
 
 void MessageFederateManager::initializeToExecuteStateTransition() {}
@@ -219,6 +344,22 @@ std::string MessageFederateManager::localQuery(const std::string& queryStr) cons
             local_endpoints.lock_shared(),
             [](const auto& info) { return info.actualName; },
             [](const auto& info) { return (!info.actualName.empty()); });
+    } else if (queryStr == "local_endpoint_queues") {
+        Json::Value base;
+        base["endpoints"] = Json::arrayValue;
+        auto epts = local_endpoints.lock_shared();
+        auto eptDat = eptData.lock_shared();
+        for (const auto& ept : epts) {
+            const auto& edat = (*eptDat)[ept.referenceIndex];
+            Json::Value eptq;
+            eptq["name"] = ept.getName();
+            eptq["queued"] = static_cast<Json::UInt64>(edat->messages.lock()->size());
+            eptq["capacity"] = edat->capacity.load();
+            eptq["policy"] = edat->overflowPolicy.load();
+            eptq["dropped"] = static_cast<Json::UInt64>(edat->dropped.load());
+            base["endpoints"].append(std::move(eptq));
+        }
+        ret = generateJsonString(base);
     }
     return ret;
 }
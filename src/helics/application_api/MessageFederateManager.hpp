@@ -12,8 +12,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Endpoints.hpp"
 #include "data_view.hpp"
 #include "gmlc/containers/DualMappedVector.hpp"
-#include "gmlc/containers/SimpleQueue.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <deque>
 #include <functional>
@@ -75,6 +75,11 @@ class MessageFederateManager {
     static std::unique_ptr<Message> getMessage(const Endpoint& ept);
     /* receive a communication message for any endpoint in the federate*/
     std::unique_ptr<Message> getMessage();
+    /** receive up to maxCount messages from a particular endpoint with a single lock of the
+    message queue*/
+    static std::vector<std::unique_ptr<Message>> receiveBatch(const Endpoint& ept, int maxCount);
+    /** receive up to maxCount messages for any endpoint in the federate*/
+    std::vector<std::unique_ptr<Message>> receiveBatch(int maxCount);
 
     /**/
     void sendMessage(const Endpoint& source, const std::string& dest, const data_view& message);
@@ -83,8 +88,21 @@ class MessageFederateManager {
                      const std::string& dest,
                      const data_view& message,
                      Time sendTime);
+    /** get an identifier from the core for a named destination*/
+    int32_t registerDestination(const std::string& dest);
+    /** send a message to a destination identifier from registerDestination*/
+    void sendMessage(const Endpoint& source,
+                     int32_t destination,
+                     const data_view& message,
+                     Time sendTime);
     /**/
     void sendMessage(const Endpoint& source, std::unique_ptr<Message> message);
+    /** send a set of messages from an endpoint in a single call to the core
+    @details either vector can contain a single element which is used for all the messages*/
+    void sendBatch(const Endpoint& source,
+                   const std::vector<std::string>& destinations,
+                   const std::vector<data_view>& messages,
+                   Time sendTime);
 
     /** update the time from oldTime to newTime
     @param newTime the newTime of the federate
@@ -129,12 +147,22 @@ class MessageFederateManager {
     void addSourceFilter(const Endpoint& ept, const std::string& filterName);
     /** add a named filter to an endpoint for all message going to the endpoint*/
     void addDestinationFilter(const Endpoint& ept, const std::string& filterName);
+    /** set the receive queue limits for an endpoint
+    @details the capacity and overflow policy options are recorded locally as well as in the core
+    so the federate side queue is held to the same limit
+    @return true if the option is a queue limit option*/
+    bool setQueueOption(const Endpoint& ept, int32_t option, int32_t value);
 
   private:
     class EndpointData {
       public:
-        gmlc::containers::SimpleQueue<std::unique_ptr<Message>> messages;
+        guarded<std::deque<std::unique_ptr<Message>>> messages;
         std::function<void(Endpoint&, Time)> callback;
+        std::atomic<int32_t> capacity{0};  //!< the maximum number of queued messages, 0 for none
+        std::atomic<int32_t> overflowPolicy{0};  //!< the action taken for a full queue
+        std::atomic<uint64_t> dropped{0};  //!< the number of messages discarded locally
+        /** add a message to the queue applying the queue limits*/
+        void addMessage(std::unique_ptr<Message> message);
     };
     shared_guarded<
         gmlc::containers::
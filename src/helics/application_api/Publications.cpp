@@ -7,9 +7,11 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "Publications.hpp"
 
+#include "../core/VectorDelta.hpp"
 #include "../core/core-exceptions.hpp"
 #include "units/units/units.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -69,19 +71,24 @@ Publication::Publication(interface_visibility locality,
 
 void Publication::publish(double val)
 {
-    bool doPublish = true;
+    data_block db;
+    if (prepareValue(val, db)) {
+        fed->publishRaw(*this, db);
+    }
+}
+
+bool Publication::prepareValue(double val, data_block& db)
+{
     if (changeDetectionEnabled) {
-        if (changeDetected(prevValue, val, delta)) {
-            prevValue = val;
-        } else {
-            doPublish = false;
+        if (!changeDetected(prevValue, val, delta)) {
+            return false;
         }
+        prevValue = val;
     }
-    if (doPublish) {
-        auto db = typeConvert(pubType, val);
-        fed->publishRaw(*this, db);
-    }
+    db = typeConvert(pubType, val);
+    return true;
 }
+
 void Publication::publishInt(int64_t val)
 {
     bool doPublish = true;
@@ -181,6 +188,9 @@ void Publication::publish(const std::vector<double>& val)
     bool doPublish = true;
     if (changeDetectionEnabled) {
         if (changeDetected(prevValue, val, delta)) {
+            if (publishVectorDelta(val.data(), val.size())) {
+                return;
+            }
             prevValue = val;
         } else {
             doPublish = false;
@@ -213,6 +223,9 @@ void Publication::publish(const double* vals, int size)
     bool doPublish = true;
     if (changeDetectionEnabled) {
         if (changeDetected(prevValue, vals, size, delta)) {
+            if (publishVectorDelta(vals, static_cast<std::size_t>(size))) {
+                return;
+            }
             prevValue = std::vector<double>(vals, vals + size);
         } else {
             doPublish = false;
@@ -224,6 +237,35 @@ void Publication::publish(const double* vals, int size)
     }
 }
 
+void Publication::setDeltaEncoding(int keyframeInterval)
+{
+    // the receiving core only rebuilds vectors for specific type names
+    bool encodable = (pubType == data_type::helics_vector && isDeltaEncodableType(getType()));
+    deltaKeyframeInterval = encodable ? keyframeInterval : 0;
+    deltasSinceKeyframe = 0;
+}
+
+bool Publication::publishVectorDelta(const double* vals, std::size_t size)
+{
+    if (deltaKeyframeInterval <= 0 || prevValue.index() != vector_loc) {
+        return false;
+    }
+    if (deltasSinceKeyframe >= deltaKeyframeInterval) {
+        deltasSinceKeyframe = 0;
+        return false;
+    }
+    auto& prev = mpark::get<std::vector<double>>(prevValue);
+    std::string deltaData;
+    if (!encodeVectorDelta(prev.data(), prev.size(), vals, size, deltaData)) {
+        deltasSinceKeyframe = 0;
+        return false;
+    }
+    std::copy(vals, vals + size, prev.begin());
+    ++deltasSinceKeyframe;
+    fed->publishRaw(*this, data_view(deltaData));
+    return true;
+}
+
 void Publication::publish(std::complex<double> val)
 {
     bool doPublish = true;
@@ -33,6 +33,8 @@ class HELICS_CXX_EXPORT Publication {
     bool changeDetectionEnabled{false};  //!< the change detection is enabled
     bool disableAssign{false};  //!< disable assignment for the object
   private:
+    int deltaKeyframeInterval{0};  //!< the maximum number of vector deltas between full values
+    int deltasSinceKeyframe{0};  //!< the number of vector deltas sent since the last full value
     size_t customTypeHash{
         0};  //!< a hash code for the custom type = 0; //!< store a hash code for a custom type
     mutable defV prevValue;  //!< the previous value of the publication
@@ -282,6 +284,13 @@ class HELICS_CXX_EXPORT Publication {
     the call to setMinimumChange
     */
     void enableChangeDetection(bool enabled = true) noexcept { changeDetectionEnabled = enabled; }
+    /** send only the changed elements of double vectors when change detection is enabled
+    @details the receiving core rebuilds the full vector so inputs see regular vector values,  a
+    full value is sent at least every keyframeInterval publications and whenever the size changes
+    or a large fraction of the elements change,  only applies to publications with a double vector
+    type
+    @param keyframeInterval the maximum number of deltas between full values, 0 to disable*/
+    void setDeltaEncoding(int keyframeInterval);
 
   private:
     /** implementation of the integer publications
@@ -290,6 +299,14 @@ class HELICS_CXX_EXPORT Publication {
     all Int types and without this it would be recursive
     */
     void publishInt(int64_t val);
+    /** publish a double vector as a delta from the previous value if possible
+    @return true if a delta was published*/
+    bool publishVectorDelta(const double* vals, std::size_t size);
+    /** apply the change detection to a double value and convert it for publication
+    @param val the value to publish
+    @param[out] db the converted value
+    @return false if the value should not be published*/
+    bool prepareValue(double val, data_block& db);
     friend class ValueFederateManager;
 };
 
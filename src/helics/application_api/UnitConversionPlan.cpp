@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "UnitConversionPlan.hpp"
+
+#include "units/units/units.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace helics {
+/** check that a linear fit of a conversion matches the conversion at another point*/
+static bool linearFitMatches(double fit, double actual)
+{
+    // allow for the rounding in the units library
+    return std::abs(fit - actual) <= 1e-12 * std::max(1.0, std::abs(actual));
+}
+
+UnitConversionPlan::UnitConversionPlan(const std::shared_ptr<units::precise_unit>& inputUnits,
+                                       const std::shared_ptr<units::precise_unit>& outputUnits)
+{
+    if (!inputUnits || !outputUnits) {
+        return;
+    }
+    const auto& inUnit = *inputUnits;
+    const auto& outUnit = *outputUnits;
+    const double zeroValue = units::convert(0.0, inUnit, outUnit);
+    const double oneValue = units::convert(1.0, inUnit, outUnit);
+    const double fitScale = oneValue - zeroValue;
+    // check two more points to make sure the conversion is actually linear
+    constexpr double testPoint1{1000.0};
+    constexpr double testPoint2{-37.25};
+    if (std::isfinite(zeroValue) && std::isfinite(oneValue) &&
+        linearFitMatches(zeroValue + fitScale * testPoint1,
+                         units::convert(testPoint1, inUnit, outUnit)) &&
+        linearFitMatches(zeroValue + fitScale * testPoint2,
+                         units::convert(testPoint2, inUnit, outUnit))) {
+        scale = fitScale;
+        offset = zeroValue;
+        if (offset != 0.0) {
+            mode = conversion_mode::affine;
+        } else if (scale != 1.0) {
+            mode = conversion_mode::scale;
+        }
+        return;
+    }
+    mode = conversion_mode::general;
+    sourceUnits = inputUnits;
+    targetUnits = outputUnits;
+}
+
+double UnitConversionPlan::applyGeneral(double val) const
+{
+    return units::convert(val, *sourceUnits, *targetUnits);
+}
+
+void UnitConversionPlan::apply(double* vals, std::size_t count) const
+{
+    // the loops are kept simple so the compiler can vectorize them
+    switch (mode) {
+        case conversion_mode::identity:
+            break;
+        case conversion_mode::scale: {
+            const double mult = scale;
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                vals[ii] *= mult;
+            }
+        } break;
+        case conversion_mode::affine: {
+            const double mult = scale;
+            const double add = offset;
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                vals[ii] = vals[ii] * mult + add;
+            }
+        } break;
+        default:
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                vals[ii] = applyGeneral(vals[ii]);
+            }
+            break;
+    }
+}
+
+void UnitConversionPlan::apply(std::complex<double>* vals, std::size_t count) const
+{
+    if (mode != conversion_mode::scale) {
+        return;
+    }
+    // std::complex<double> is guaranteed to have the layout of double[2]
+    auto* parts = reinterpret_cast<double*>(vals);
+    const double mult = scale;
+    for (std::size_t ii = 0; ii < 2 * count; ++ii) {
+        parts[ii] *= mult;
+    }
+}
+}  // namespace helics
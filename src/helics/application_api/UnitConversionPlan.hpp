@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "helics_cxx_export.h"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace units {
+class precise_unit;
+}  // namespace units
+
+namespace helics {
+/** a unit conversion between the units of a publication and an input computed once when the
+link is established
+@details most conversions are of the form scale*value+offset,  those are detected when the plan is
+constructed so applying the plan does not need the units library.  Conversions which are not linear
+(logarithmic units for example) fall back to converting each value through the units library.
+*/
+class HELICS_CXX_EXPORT UnitConversionPlan {
+  public:
+    /** default constructor,  the plan does not modify any values*/
+    UnitConversionPlan() = default;
+    /** construct a plan to convert values from the inputUnits to the outputUnits
+    @details if either unit is missing the plan does not modify any values*/
+    UnitConversionPlan(const std::shared_ptr<units::precise_unit>& inputUnits,
+                       const std::shared_ptr<units::precise_unit>& outputUnits);
+    /** check if the plan leaves the values unchanged*/
+    bool isIdentity() const { return mode == conversion_mode::identity; }
+    /** get the multiplier of a linear conversion*/
+    double getScale() const { return scale; }
+    /** get the offset of a linear conversion*/
+    double getOffset() const { return offset; }
+
+    /** convert a single value*/
+    double apply(double val) const
+    {
+        switch (mode) {
+            case conversion_mode::identity:
+                return val;
+            case conversion_mode::scale:
+                return val * scale;
+            case conversion_mode::affine:
+                return val * scale + offset;
+            default:
+                return applyGeneral(val);
+        }
+    }
+    /** convert an array of values in place*/
+    void apply(double* vals, std::size_t count) const;
+    /** convert an array of complex values in place
+    @details only a pure scaling is applied to complex values,  the real and imaginary parts are
+    scaled by the same factor,  conversions with an offset leave the values unchanged*/
+    void apply(std::complex<double>* vals, std::size_t count) const;
+
+  private:
+    enum class conversion_mode : std::uint8_t {
+        identity = 0,  //!< no conversion
+        scale = 1,  //!< multiply by scale
+        affine = 2,  //!< multiply by scale and add offset
+        general = 3,  //!< convert through the units library
+    };
+    /** convert a value through the units library*/
+    double applyGeneral(double val) const;
+
+    conversion_mode mode{conversion_mode::identity};
+    double scale{1.0};  //!< the multiplier of a linear conversion
+    double offset{0.0};  //!< the offset of a linear conversion
+    /// the units for a conversion that is not linear
+    std::shared_ptr<units::precise_unit> sourceUnits;
+    std::shared_ptr<units::precise_unit> targetUnits;
+};
+}  // namespace helics
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include "../core/core-data.hpp"
+#include "FixedLayoutCodec.hpp"
 #include "data_view.hpp"
 #include "helicsTypes.hpp"
 
@@ -188,32 +189,92 @@ namespace detail {
     };
 }  // namespace detail
 
+namespace detail {
+    /** convert a value with a fixed layout encoding*/
+    template<class X>
+    void convertValue(const X& val, data_block& store, std::true_type /*fixedLayout*/)
+    {
+        store.resize(FixedLayoutCodec<X>::encodedSize(val));
+        FixedLayoutCodec<X>::encode(val, store.data());
+    }
+
+    /** convert a value through the portable binary archive*/
+    template<class X>
+    void convertValue(const X& val, data_block& store, std::false_type /*fixedLayout*/)
+    {
+        ostringbufstream s;
+        archiver oa(s);
+
+        oa(val);
+
+        // don't forget to flush the stream to finish writing into the buffer
+        s.flush();
+        store = s.extractString();
+    }
+
+    /** convert an array of values with a fixed layout encoding*/
+    template<class X>
+    void convertArray(const X* vals, size_t size, data_block& store, std::true_type /*fixedLayout*/)
+    {
+        store.resize(FixedLayoutCodec<X>::encodedArraySize(size));
+        FixedLayoutCodec<X>::encodeArray(vals, size, store.data());
+    }
+
+    /** convert an array of values through the portable binary archive*/
+    template<class X>
+    void
+        convertArray(const X* vals, size_t size, data_block& store, std::false_type /*fixedLayout*/)
+    {
+        ostringbufstream s;
+        archiver oa(s);
+        oa(cereal::make_size_tag(static_cast<cereal::size_type>(size)));  // number of elements
+        for (size_t ii = 0; ii < size; ++ii) {
+            oa(vals[ii]);
+        }
+        // don't forget to flush the stream to finish writing into the buffer
+        s.flush();
+        store = s.extractString();
+    }
+
+    /** interpret a value with a fixed layout encoding*/
+    template<class X>
+    void interpretValue(const data_view& block, X& val, std::true_type /*fixedLayout*/)
+    {
+        if (!FixedLayoutCodec<X>::decode(block.data(), block.size(), val)) {
+            throw std::invalid_argument("unable to interpret data block");
+        }
+    }
+
+    /** interpret a value through the portable binary archive*/
+    template<class X>
+    void interpretValue(const data_view& block, X& val, std::false_type /*fixedLayout*/)
+    {
+        imemstream s(block.data(), block.size());
+        retriever ia(s);
+        try {
+            ia(val);
+        }
+        catch (const cereal::Exception& ce) {
+            throw std::invalid_argument(ce.what());
+        }
+    }
+
+    /** check if a type has a fixed layout encoding*/
+    template<class X>
+    using hasFixedLayout = std::integral_constant<bool, FixedLayoutCodec<X>::supported>;
+}  // namespace detail
+
 template<class X>
 void ValueConverter<X>::convert(const X& val, data_block& store)
 {
-    detail::ostringbufstream s;
-    archiver oa(s);
-
-    oa(val);
-
-    // don't forget to flush the stream to finish writing into the buffer
-    s.flush();
-    store = s.extractString();
+    detail::convertValue(val, store, detail::hasFixedLayout<X>{});
 }
 
 template<class X>
 void ValueConverter<X>::convert(const X* vals, size_t size, data_block& store)
 {
-    detail::ostringbufstream s;
-    archiver oa(s);
-    oa(cereal::make_size_tag(static_cast<cereal::size_type>(size)));  // number of elements
-    for (size_t ii = 0; ii < size; ++ii) {
-        oa(vals[ii]);
-    }
-    // don't forget to flush the stream to finish writing into the buffer
-    s.flush();
-    // store = std::move (data);
-    store = s.extractString();
+    // arrays are encoded with the same layout as a vector of the elements
+    detail::convertArray(vals, size, store, detail::hasFixedLayout<std::vector<X>>{});
 }
 
 /** template trait for figuring out if something is a vector of objects*/
@@ -303,14 +364,7 @@ void ValueConverter<X>::interpret(const data_view& block, X& val)
             std::to_string(getMinSize<X>()) + ", received " + std::to_string(block.size());
         throw std::invalid_argument(arg);
     }
-    detail::imemstream s(block.data(), block.size());
-    retriever ia(s);
-    try {
-        ia(val);
-    }
-    catch (const cereal::Exception& ce) {
-        throw std::invalid_argument(ce.what());
-    }
+    detail::interpretValue(block, val, detail::hasFixedLayout<X>{});
 }
 
 template<class X>
@@ -402,6 +402,27 @@ void ValueFederate::publish(Publication& pub, double val)
     pub.publish(val);
 }
 
+void ValueFederate::publishBatch(Publication* const* pubs, const double* vals, int count)
+{
+    if ((currentMode == modes::executing) || (currentMode == modes::initializing)) {
+        if (count > 0) {
+            vfManager->publishBatch(pubs, vals, count);
+        }
+    } else {
+        throw(InvalidFunctionCall(
+            "publications not allowed outside of execution and initialization state"));
+    }
+}
+
+void ValueFederate::publishBatch(const std::vector<Publication*>& pubs,
+                                 const std::vector<double>& vals)
+{
+    if (pubs.size() != vals.size()) {
+        throw(InvalidParameter("the number of values does not match the number of publications"));
+    }
+    publishBatch(pubs.data(), vals.data(), static_cast<int>(pubs.size()));
+}
+
 using dvalue = mpark::variant<double, std::string>;
 
 static void generateData(std::vector<std::pair<std::string, dvalue>>& vpairs,
@@ -511,6 +532,17 @@ std::vector<int> ValueFederate::queryUpdates()
     return vfManager->queryUpdates();
 }
 
+int ValueFederate::getInputDoubles(double* values,
+                                   Time* updateTimes,
+                                   std::uint8_t* updateMask,
+                                   int count)
+{
+    if (values == nullptr || count <= 0) {
+        return 0;
+    }
+    return vfManager->getInputDoubles(values, updateTimes, updateMask, count);
+}
+
 const std::string& ValueFederate::getTarget(const Input& inp) const
 {
     return vfManager->getTarget(inp);
@@ -615,6 +647,11 @@ void ValueFederate::setInputNotificationCallback(Input& inp,
     vfManager->setInputNotificationCallback(inp, std::move(callback));
 }
 
+void ValueFederate::registerInputBatch(std::unique_ptr<InputBatchDispatcher> batch)
+{
+    vfManager->registerInputBatch(std::move(batch));
+}
+
 int ValueFederate::getPublicationCount() const
 {
     return vfManager->getPublicationCount();
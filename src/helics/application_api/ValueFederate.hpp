@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueConverter.hpp"
 #include "data_view.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -21,6 +22,7 @@ class Publication;
 class Input;
 /** @brief PIMPL design pattern with the implementation details for the ValueFederate*/
 class ValueFederateManager;
+class InputBatchDispatcher;
 /** class defining the value based interface */
 class HELICS_CXX_EXPORT ValueFederate:
     public virtual Federate  // using virtual inheritance to allow combination federate
@@ -465,6 +467,25 @@ class HELICS_CXX_EXPORT ValueFederate:
  */
     static void publish(Publication& pub, double val);
 
+    /** publish double values to a set of publications in a single batch
+    @details change detection is applied to each publication the same as Publication::publish,
+    the values that pass are converted and handed to the core in a single call which sends one
+    command per destination instead of one per publication
+    @param pubs an array of pointers to the publications
+    @param vals an array of values, one for each publication
+    @param count the number of publications
+    @throw InvalidIdentifier if any of the publications is not valid
+    @throw InvalidFunctionCall if called outside of initialization or execution
+    */
+    void publishBatch(Publication* const* pubs, const double* vals, int count);
+
+    /** publish double values to a set of publications in a single batch
+    @param pubs a vector of pointers to the publications
+    @param vals a vector of values, one for each publication
+    @throw InvalidParameter if the vectors are not the same size
+    */
+    void publishBatch(const std::vector<Publication*>& pubs, const std::vector<double>& vals);
+
     /** register a set of publications based on a publication JSON
     @param jsonString a json string containing the data to publish and establish publications from
     */
@@ -548,6 +569,19 @@ class HELICS_CXX_EXPORT ValueFederate:
     */
     std::vector<int> queryUpdates();
 
+    /** get the values of all the inputs as doubles in a single call
+    @details the arrays are filled in input index order, the same indices used in queryUpdates.
+    Each input is read as if getValue<double> were called on it so the update flags are cleared
+    @param[out] values an array of at least count doubles for the current values
+    @param[out] updateTimes an array of at least count times for the time of the last update of
+    each input, may be nullptr if not needed
+    @param[out] updateMask a bitmap of at least (count+7)/8 bytes,  bit ii%8 of byte ii/8 is set if
+    input ii was updated,  may be nullptr if not needed
+    @param count the size of the arrays
+    @return the number of inputs written,  the smaller of count and the number of inputs
+    */
+    int getInputDoubles(double* values, Time* updateTimes, std::uint8_t* updateMask, int count);
+
     /** get the name of the first target for an input
     @return empty string if an invalid input is passed or it has no target*/
     const std::string& getTarget(const Input& inp) const;
@@ -629,6 +663,12 @@ class HELICS_CXX_EXPORT ValueFederate:
     @param callback the function to call
     */
     void setInputNotificationCallback(Input& inp, std::function<void(Input&, Time)> callback);
+    /** register a dispatcher that delivers the updates of a group of inputs once per time request
+    @details the inputs of the group no longer trigger their individual notification callbacks or
+    the federate wide callback,  an input can only be part of one group
+    @param batch the dispatcher to register,  usually created through setInputBatchCallback
+    */
+    void registerInputBatch(std::unique_ptr<InputBatchDispatcher> batch);
 
     /** get a count of the number publications registered*/
     int getPublicationCount() const;
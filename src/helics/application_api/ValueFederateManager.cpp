@@ -12,7 +12,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Inputs.hpp"
 #include "Publications.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 namespace helics {
 ValueFederateManager::ValueFederateManager(Core* coreOb, ValueFederate* vfed, local_federate_id id):
     coreObject(coreOb), fed(vfed), fedID(id)
@@ -200,6 +204,35 @@ void ValueFederateManager::publish(const Publication& pub, const data_view& bloc
     coreObject->setValue(pub.handle, block.data(), block.size());
 }
 
+void ValueFederateManager::publishBatch(Publication* const* pubs, const double* vals, int count)
+{
+    for (int ii = 0; ii < count; ++ii) {
+        if (pubs[ii] == nullptr || !pubs[ii]->isValid()) {
+            throw(InvalidIdentifier("publication is not valid (publishBatch)"));
+        }
+    }
+    std::vector<interface_handle> handles;
+    std::vector<uint64_t> offsets;
+    std::string buffer;
+    handles.reserve(count);
+    offsets.reserve(count + 1);
+    offsets.push_back(0);
+    data_block db;
+    for (int ii = 0; ii < count; ++ii) {
+        if (pubs[ii]->prepareValue(vals[ii], db)) {
+            handles.push_back(pubs[ii]->handle);
+            buffer.append(db.data(), db.size());
+            offsets.push_back(buffer.size());
+        }
+    }
+    if (!handles.empty()) {
+        coreObject->setValues(handles.data(),
+                              buffer.data(),
+                              offsets.data(),
+                              static_cast<int>(handles.size()));
+    }
+}
+
 bool ValueFederateManager::hasUpdate(const Input& inp)
 {
     auto* iData = static_cast<input_info*>(inp.dataReference);
@@ -228,6 +261,7 @@ void ValueFederateManager::updateTime(Time newTime, Time /*oldTime*/)
     // lock the data updates
     auto inpHandle = inputs.lock();
     auto allCall = allCallback.load();
+    std::vector<InputBatchDispatcher*> pendingBatches;
     for (auto handle : handles) {
         /** find the id*/
         auto fid = inpHandle->find(handle);
@@ -248,7 +282,13 @@ void ValueFederateManager::updateTime(Time newTime, Time /*oldTime*/)
             }
 
             if (updated) {
-                if (iData->callback) {
+                if (iData->batch != nullptr) {
+                    // group callbacks are delivered once all the updates are processed
+                    if (!iData->batch->hasPending()) {
+                        pendingBatches.push_back(iData->batch);
+                    }
+                    iData->batch->markUpdated(iData->batchIndex);
+                } else if (iData->callback) {
                     Input& inp = *fid;
 
                     inpHandle.unlock();  // need to free the lock
@@ -268,6 +308,13 @@ void ValueFederateManager::updateTime(Time newTime, Time /*oldTime*/)
             }
         }
     }
+    if (!pendingBatches.empty()) {
+        inpHandle.unlock();
+        // dispatchers are never removed so the pointers remain valid during the callbacks
+        for (auto* batch : pendingBatches) {
+            batch->dispatch(CurrentTime);
+        }
+    }
 }
 
 void ValueFederateManager::startupToInitializeStateTransition()
@@ -373,6 +420,30 @@ std::vector<int> ValueFederateManager::queryUpdates()
     return updates;
 }
 
+int ValueFederateManager::getInputDoubles(double* values,
+                                          Time* updateTimes,
+                                          std::uint8_t* updateMask,
+                                          int count)
+{
+    auto inpHandle = inputs.lock();
+    int total = std::min(count, static_cast<int>(inpHandle->size()));
+    if (updateMask != nullptr) {
+        std::fill(updateMask, updateMask + (total + 7) / 8, std::uint8_t{0});
+    }
+    for (int ii = 0; ii < total; ++ii) {
+        auto& inp = (*inpHandle)[ii];
+        if (updateMask != nullptr && inp.isUpdated()) {
+            updateMask[ii / 8] |= static_cast<std::uint8_t>(1U << (ii % 8));
+        }
+        values[ii] = inp.getValue<double>();
+        if (updateTimes != nullptr) {
+            auto* iData = static_cast<input_info*>(inp.dataReference);
+            updateTimes[ii] = (iData != nullptr) ? iData->lastUpdate : Time::minVal();
+        }
+    }
+    return total;
+}
+
 static const std::string emptyStr;
 
 const std::string& ValueFederateManager::getTarget(const Input& inp) const
@@ -535,4 +606,28 @@ void ValueFederateManager::setInputNotificationCallback(const Input& inp,
     }
 }
 
+void ValueFederateManager::registerInputBatch(std::unique_ptr<InputBatchDispatcher> batch)
+{
+    if (!batch) {
+        return;
+    }
+    auto inpHandle = inputs.lock();
+    std::vector<Input*> stored;
+    stored.reserve(batch->inputs.size());
+    for (auto* inp : batch->inputs) {
+        auto fid = (inp != nullptr) ? inpHandle->find(inp->getHandle()) : inpHandle->end();
+        if (fid == inpHandle->end()) {
+            throw(InvalidIdentifier("Input is not valid"));
+        }
+        stored.push_back(&(*fid));
+    }
+    for (std::size_t ii = 0; ii < stored.size(); ++ii) {
+        auto* iData = static_cast<input_info*>(stored[ii]->dataReference);
+        iData->batch = batch.get();
+        iData->batchIndex = static_cast<int>(ii);
+    }
+    batch->inputs = std::move(stored);
+    inputBatches.lock()->push_back(std::move(batch));
+}
+
 }  // namespace helics
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/GuardedTypes.hpp"
 #include "../core/federate_id.hpp"
+#include "InputBatchCallback.hpp"
 #include "Inputs.hpp"
 #include "Publications.hpp"
 #include "data_view.hpp"
@@ -55,6 +56,8 @@ struct input_info {
     std::string pubtype;  //!< the listed type of the corresponding publication
 
     std::function<void(Input&, Time)> callback;  //!< callback to trigger on update
+    InputBatchDispatcher* batch{nullptr};  //!< the group dispatcher the input belongs to
+    int batchIndex{-1};  //!< the index of the input in the group dispatcher
     bool hasUpdate = false;  //!< indicator that there was an update
     input_info(const std::string& n_name, const std::string& n_type, const std::string& n_units):
         name(n_name), type(n_type), units(n_units)
@@ -128,6 +131,9 @@ class ValueFederateManager {
 
     /** publish a value*/
     void publish(const Publication& pub, const data_view& block);
+    /** publish double values for a set of publications in a single call to the core
+    @details change detection is applied to each publication individually*/
+    void publishBatch(Publication* const* pubs, const double* vals, int count);
 
     /** check if a given subscription has and update*/
     static bool hasUpdate(const Input& inp);
@@ -151,6 +157,10 @@ class ValueFederateManager {
     */
     std::vector<int> queryUpdates();
 
+    /** read the values of the inputs as doubles into contiguous arrays
+    @details all inputs are read under a single lock,  see ValueFederate::getInputDoubles*/
+    int getInputDoubles(double* values, Time* updateTimes, std::uint8_t* updateMask, int count);
+
     /** get the target of a input*/
     const std::string& getTarget(const Input& inp) const;
 
@@ -188,6 +198,10 @@ class ValueFederateManager {
     */
     static void setInputNotificationCallback(const Input& inp,
                                              std::function<void(Input&, Time)> callback);
+    /** register a dispatcher for a group of inputs
+    @details the inputs of the dispatcher are replaced with the inputs stored in the manager
+    @throw InvalidIdentifier if any of the inputs is not valid*/
+    void registerInputBatch(std::unique_ptr<InputBatchDispatcher> batch);
 
     /** disconnect from the coreObject*/
     void disconnect();
@@ -223,6 +237,8 @@ class ValueFederateManager {
         allCallback;  //!< the global callback function
     shared_guarded<std::vector<std::unique_ptr<input_info>>>
         inputData;  //!< the storage for the message queues and other unique Endpoint information
+    shared_guarded<std::vector<std::unique_ptr<InputBatchDispatcher>>>
+        inputBatches;  //!< the group dispatchers for input updates
     shared_guarded<std::multimap<std::string, interface_handle>>
         targetIDs;  //!< container for the target identifications
     shared_guarded<std::multimap<interface_handle, std::string>>
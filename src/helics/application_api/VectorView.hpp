@@ -0,0 +1,183 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "FixedLayoutCodec.hpp"
+#include "data_view.hpp"
+
+#include <complex>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** read only view of a vector value
+@details when constructed from received data the view holds a reference to the data block and the
+elements are read directly out of it without deserializing into a new vector,  the view keeps the
+data alive so it remains usable after the input receives new values.  Element access through the
+index operator and the iterators works regardless of the alignment of the data and never copies.
+The encoded elements follow a 9 byte header so they are usually not aligned in the received
+buffer,  data() then copies them into an aligned buffer held by the view once on the first call,
+and returns a pointer directly into the received data only if it is aligned and in native byte
+order.  The wire layout is unchanged so no negotiation with other federates is needed.
+@tparam T double or std::complex<double>
+*/
+template<class T>
+class VectorView {
+    static_assert(std::is_same<T, double>::value || std::is_same<T, std::complex<double>>::value,
+                  "vector views are only available for double and complex<double> elements");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    /** iterator over the elements of the view,  the elements are returned by value*/
+    class const_iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = T;
+
+        const_iterator() = default;
+        const_iterator(const VectorView* view, size_type index): vv(view), ii(index) {}
+        T operator*() const { return (*vv)[ii]; }
+        const_iterator& operator++()
+        {
+            ++ii;
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++ii;
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const { return ii == other.ii; }
+        bool operator!=(const const_iterator& other) const { return ii != other.ii; }
+        difference_type operator-(const const_iterator& other) const
+        {
+            return static_cast<difference_type>(ii) - static_cast<difference_type>(other.ii);
+        }
+
+      private:
+        const VectorView* vv{nullptr};
+        size_type ii{0};
+    };
+    /** default constructor for an empty view*/
+    VectorView() = default;
+    /** construct a view on encoded vector data
+    @param dv the data to view
+    @param encodedType the type of data encoded in dv (helics_vector or helics_complex_vector)
+    a double view of a complex vector contains the interleaved real and imaginary parts*/
+    VectorView(data_view dv, data_type encodedType): source(std::move(dv))
+    {
+        attach(encodedType);
+    }
+    /** construct a view owning a set of values*/
+    explicit VectorView(std::vector<T> values):
+        count(values.size()), isValid(true), local(std::move(values))
+    {
+    }
+    /** check if the view was successfully constructed*/
+    bool valid() const { return isValid; }
+    /** get the number of elements in the view*/
+    size_type size() const { return count; }
+    /** check if the view has no elements*/
+    bool empty() const { return count == 0; }
+    /** check if the elements are read directly from the received data*/
+    bool isZeroCopy() const { return elements != nullptr; }
+    /** get an element of the view*/
+    T operator[](size_type index) const
+    {
+        return (elements != nullptr) ? loadElement(index, T{}) : local[index];
+    }
+    /** get an element of the view with bounds checking*/
+    T at(size_type index) const
+    {
+        if (index >= count) {
+            throw std::out_of_range("vector view index out of range");
+        }
+        return operator[](index);
+    }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+    /** get a pointer to contiguous aligned elements
+    @details the pointer remains valid for the lifetime of the view*/
+    const T* data() const
+    {
+        if (elements == nullptr) {
+            return local.data();
+        }
+        if (!swap && reinterpret_cast<std::uintptr_t>(elements) % alignof(T) == 0) {
+            return reinterpret_cast<const T*>(elements);
+        }
+        if (local.size() != count) {
+            local.resize(count);
+            // std::complex<double> is guaranteed to have the layout of double[2]
+            detail::loadCodecArray<sizeof(double)>(reinterpret_cast<char*>(local.data()),
+                                                   elements,
+                                                   count * sizeof(T) / sizeof(double),
+                                                   swap);
+        }
+        return local.data();
+    }
+    /** copy the elements into a vector*/
+    std::vector<T> toVector() const
+    {
+        const T* vals = data();
+        return std::vector<T>(vals, vals + count);
+    }
+
+  private:
+    /** locate the elements in the encoded data*/
+    void attach(data_type encodedType)
+    {
+        std::size_t encodedElementSize{0};
+        if (encodedType == data_type::helics_vector) {
+            encodedElementSize = sizeof(double);
+        } else if (encodedType == data_type::helics_complex_vector) {
+            encodedElementSize = 2 * sizeof(double);
+        }
+        // a complex view is only possible on complex data
+        if (encodedElementSize < sizeof(T) ||
+            source.size() < 1 + sizeof(detail::codec_size_type) ||
+            !detail::checkCodecMarker(source.data(), swap)) {
+            return;
+        }
+        const char* loc = source.data() + 1;
+        std::size_t encodedCount{0};
+        if (!detail::loadCodecSize(
+                loc, source.data() + source.size(), encodedElementSize, swap, encodedCount)) {
+            return;
+        }
+        count = encodedCount * (encodedElementSize / sizeof(T));
+        elements = (count > 0) ? loc : nullptr;
+        isValid = true;
+    }
+    double loadElement(size_type index, double /*tag*/) const
+    {
+        return detail::loadCodecScalar<double>(elements + index * sizeof(double), swap);
+    }
+    std::complex<double> loadElement(size_type index, std::complex<double> /*tag*/) const
+    {
+        const char* loc = elements + index * 2 * sizeof(double);
+        return {detail::loadCodecScalar<double>(loc, swap),
+                detail::loadCodecScalar<double>(loc + sizeof(double), swap)};
+    }
+
+    data_view source;  //!< the data being viewed
+    const char* elements{nullptr};  //!< the location of the first element in the data
+    size_type count{0};  //!< the number of elements
+    bool swap{false};  //!< the data needs to be byte swapped
+    bool isValid{false};  //!< the view was constructed successfully
+    mutable std::vector<T> local;  //!< owned or aligned copy of the elements
+};
+}  // namespace helics
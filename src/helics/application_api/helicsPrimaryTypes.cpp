@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "HelicsPrimaryTypes.hpp"
 
 #include "../utilities/timeStringOps.hpp"
+#include "ChangeDetectionKernels.hpp"
 #include "ValueConverter.hpp"
 
 #include <set>
@@ -70,12 +71,7 @@ bool changeDetected(const defV& prevValue, const std::vector<double>& val, doubl
     if (prevValue.index() == vector_loc) {
         const auto& prevV = mpark::get<std::vector<double>>(prevValue);
         if (val.size() == prevV.size()) {
-            for (size_t ii = 0; ii < val.size(); ++ii) {
-                if (std::abs(prevV[ii] - val[ii]) > deltaV) {
-                    return true;
-                }
-            }
-            return false;
+            return detail::anyDifferenceExceeds(prevV.data(), val.data(), val.size(), deltaV);
         }
     }
     return true;
@@ -88,12 +84,7 @@ bool changeDetected(const defV& prevValue,
     if (prevValue.index() == complex_vector_loc) {
         const auto& prevV = mpark::get<std::vector<std::complex<double>>>(prevValue);
         if (val.size() == prevV.size()) {
-            for (size_t ii = 0; ii < val.size(); ++ii) {
-                if (std::abs(prevV[ii] - val[ii]) > deltaV) {
-                    return true;
-                }
-            }
-            return false;
+            return detail::anyDifferenceExceeds(prevV.data(), val.data(), val.size(), deltaV);
         }
     }
     return true;
@@ -104,12 +95,7 @@ bool changeDetected(const defV& prevValue, const double* vals, size_t size, doub
     if (prevValue.index() == vector_loc) {
         const auto& prevV = mpark::get<std::vector<double>>(prevValue);
         if (size == prevV.size()) {
-            for (size_t ii = 0; ii < size; ++ii) {
-                if (std::abs(prevV[ii] - vals[ii]) > deltaV) {
-                    return true;
-                }
-            }
-            return false;
+            return detail::anyDifferenceExceeds(prevV.data(), vals, size, deltaV);
         }
     }
     return true;
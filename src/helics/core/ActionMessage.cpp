@@ -33,7 +33,7 @@ ActionMessage::ActionMessage(action_message_def::action_t startingAction,
 ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime),
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
     payload(std::move(act.payload)), name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso),
     stringData(std::move(act.stringData))
 {
@@ -42,8 +42,9 @@ ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
 ActionMessage::ActionMessage(const ActionMessage& act):
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime), payload(act.payload),
-    name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData)
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
+    payload(act.payload), name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso),
+    stringData(act.stringData)
 
 {
 }
@@ -85,6 +86,7 @@ ActionMessage& ActionMessage::operator=(const ActionMessage& act)  // NOLINT
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
@@ -104,6 +106,7 @@ ActionMessage& ActionMessage::operator=(ActionMessage&& act) noexcept
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
@@ -660,6 +663,7 @@ static constexpr std::pair<action_message_def::action_t, const char*> actionStri
     {action_message_def::action_t::cmd_reg_end, "reg_end"},
     {action_message_def::action_t::cmd_resend, "reg_resend"},
     {action_message_def::action_t::cmd_add_endpoint, "add_endpoint"},
+    {action_message_def::action_t::cmd_endpoint_location, "endpoint location"},
     {action_message_def::action_t::cmd_remove_endpoint, "remove endpoint"},
     {action_message_def::action_t::cmd_add_named_endpoint, "add_named_endpoint"},
     {action_message_def::action_t::cmd_add_named_input, "add_named_input"},
@@ -674,6 +678,7 @@ static constexpr std::pair<action_message_def::action_t, const char*> actionStri
     {action_message_def::action_t::cmd_remove_named_filter, "remove_named_filter"},
     {action_message_def::action_t::cmd_close_interface, "close_interface"},
     {action_message_def::action_t::cmd_multi_message, "multi message"},
+    {action_message_def::action_t::cmd_message_chunk, "message chunk"},
     {action_message_def::action_t::cmd_broker_configure, "broker_configure"},
     {action_message_def::action_t::cmd_time_barrier_request, "request time barrier"},
     {action_message_def::action_t::cmd_time_barrier, "time barrier"},
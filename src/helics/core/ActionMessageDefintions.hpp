@@ -147,6 +147,7 @@ across different compilers*/
         cmd_add_subscriber = 70,  //!< notify of a subscription
         cmd_reg_end = cmd_info_basis + 90,  //!< register an endpoint
         cmd_add_endpoint = 90,  //!< notify of a source endpoint
+        cmd_endpoint_location = 92,  //!< notify a core of the handle of a named endpoint
 
         cmd_add_named_input = 104,  //!< command to add a named input as a target
         cmd_add_named_filter = 105,  //!< command to add named filter as a target
@@ -165,6 +166,7 @@ across different compilers*/
 
         cmd_close_interface = 133,  //!< cmd to close all communications from an interface
         cmd_multi_message = 1037,  //!< cmd that encapsulates a bunch of messages in its payload
+        cmd_message_chunk = 1039,  //!< cmd containing a part of a message split for transmission
 
         cmd_connection_error = 2034,  //!< cmd indicating a connection error with a broker/federate
 
@@ -279,6 +281,7 @@ across different compilers*/
 
 #define CMD_REG_ENDPOINT action_message_def::action_t::cmd_reg_end
 #define CMD_ADD_ENDPOINT action_message_def::action_t::cmd_add_endpoint
+#define CMD_ENDPOINT_LOCATION action_message_def::action_t::cmd_endpoint_location
 
 #define CMD_REG_FILTER action_message_def::action_t::cmd_reg_filter
 #define CMD_ADD_FILTER action_message_def::action_t::cmd_add_filter
@@ -316,6 +319,7 @@ across different compilers*/
 #define CMD_SET_GLOBAL action_message_def::action_t::cmd_set_global
 
 #define CMD_MULTI_MESSAGE action_message_def::action_t::cmd_multi_message
+#define CMD_MESSAGE_CHUNK action_message_def::action_t::cmd_message_chunk
 
 // definitions for the protocol options
 #define PROTOCOL_PING 10
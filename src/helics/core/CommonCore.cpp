@@ -34,6 +34,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <cstring>
 #include <fstream>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -346,8 +347,7 @@ bool CommonCore::isLocal(global_federate_id global_fedid) const
 
 route_id CommonCore::getRoute(global_federate_id global_fedid) const
 {
-    auto fnd = routing_table.find(global_fedid);
-    return (fnd != routing_table.end()) ? fnd->second : parent_route_id;
+    return routing_table.getRoute(global_fedid);
 }
 
 bool CommonCore::isConfigured() const
@@ -1291,6 +1291,78 @@ void CommonCore::setValue(interface_handle handle, const char* data, uint64_t le
     }
 }
 
+void CommonCore::setValues(const interface_handle* pubHandles,
+                           const char* data,
+                           const uint64_t* offsets,
+                           int count)
+{
+    // check all the handles first so an error does not leave the batch partially published
+    for (int ii = 0; ii < count; ++ii) {
+        const auto* handleInfo = getHandleInfo(pubHandles[ii]);
+        if (handleInfo == nullptr) {
+            throw(InvalidIdentifier("Handle not valid (setValues)"));
+        }
+        if (handleInfo->handleType != handle_type::publication) {
+            throw(InvalidIdentifier("handle does not point to a publication or control output"));
+        }
+    }
+    // the updates are grouped by destination so each destination gets a single command
+    std::map<global_federate_id, std::vector<ActionMessage>> updates;
+    for (int ii = 0; ii < count; ++ii) {
+        const auto* handleInfo = getHandleInfo(pubHandles[ii]);
+        if (checkActionFlag(*handleInfo, disconnected_flag) || !handleInfo->used) {
+            continue;
+        }
+        auto* fed = getFederateAt(handleInfo->local_fed_id);
+        const char* valueData = data + offsets[ii];
+        auto len = offsets[ii + 1] - offsets[ii];
+        if (!fed->checkAndSetValue(pubHandles[ii], valueData, len)) {
+            continue;
+        }
+        if (fed->loggingLevel() >= helics_log_level_data) {
+            fed->logMessage(helics_log_level_data,
+                            fed->getIdentifier(),
+                            fmt::format("setting value for {} size {}", handleInfo->key, len));
+        }
+        auto subs = fed->getSubscribers(pubHandles[ii]);
+        if (subs.empty()) {
+            continue;
+        }
+        ActionMessage mv(CMD_PUB);
+        mv.source_id = handleInfo->getFederateId();
+        mv.source_handle = pubHandles[ii];
+        mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
+        mv.payload = std::string(valueData, len);
+        mv.actionTime = fed->nextAllowedSendTime();
+        for (auto& target : subs) {
+            mv.setDestination(target);
+            updates[target.fed_id].push_back(mv);
+        }
+    }
+
+    for (auto& destUpdates : updates) {
+        auto& messages = destUpdates.second;
+        if (messages.size() == 1) {
+            actionQueue.push(std::move(messages.front()));
+            continue;
+        }
+        ActionMessage package(CMD_MULTI_MESSAGE);
+        package.source_id = messages.front().source_id;
+        package.source_handle = messages.front().source_handle;
+        for (auto& mv : messages) {
+            if (appendMessage(package, mv) < 0) {
+                // deal with the max package size
+                actionQueue.push(std::move(package));
+                package = ActionMessage(CMD_MULTI_MESSAGE);
+                package.source_id = mv.source_id;
+                package.source_handle = mv.source_handle;
+                appendMessage(package, mv);
+            }
+        }
+        actionQueue.push(std::move(package));
+    }
+}
+
 const std::shared_ptr<const data_block>& CommonCore::getValue(interface_handle handle,
                                                               uint32_t* inputIndex)
 {
@@ -1569,7 +1641,7 @@ void CommonCore::send(interface_handle sourceHandle,
     m.source_id = hndl->getFederateId();
 
     m.payload = std::string(data, length);
-    m.setStringData(destination, hndl->key, hndl->key);
+    setMessageDestination(m, destination);
     m.actionTime = fed->nextAllowedSendTime();
     addActionMessage(std::move(m));
 }
@@ -1593,11 +1665,93 @@ void CommonCore::sendEvent(Time time,
     auto minTime = getFederateAt(hndl->local_fed_id)->nextAllowedSendTime();
     m.actionTime = std::max(time, minTime);
     m.payload = std::string(data, length);
-    m.setStringData(destination, hndl->key, hndl->key);
+    setMessageDestination(m, destination);
     m.messageID = ++messageCounter;
     addActionMessage(std::move(m));
 }
 
+void CommonCore::setMessageDestination(ActionMessage& message, const std::string& destination)
+{
+    // the source names are left out and filled in on the core thread only if they are needed
+    message.setStringData(destination);
+    setActionFlag(message, compact_message_flag);
+}
+
+void CommonCore::setMessageDestination(ActionMessage& message, int32_t destination)
+{
+    auto dests = registeredDestinations.lock_shared();
+    if (destination < 0 || destination >= static_cast<int32_t>(dests->size())) {
+        throw(InvalidIdentifier("destination is not valid"));
+    }
+    const auto& dest = (*dests)[destination];
+    if (dest.handle.isValid() && dest.local) {
+        message.setDestination(dest.handle);
+        setActionFlag(message, compact_message_flag);
+        return;
+    }
+    setMessageDestination(message, dest.name);
+    if (dest.handle.isValid()) {
+        message.setDestination(dest.handle);
+        setActionFlag(message, located_destination_flag);
+    }
+}
+
+void CommonCore::addEndpointLocation(const ActionMessage& command)
+{
+    if (checkActionFlag(command, disconnected_flag)) {
+        removeEndpointLocations(command.getSource());
+        return;
+    }
+    const auto& name = command.name;
+    knownExternalEndpoints[name] = std::make_pair(command.getSource(), getRoute(command.source_id));
+    registeredDestinations.modify([&name, &command](auto& dests) {
+        auto fnd = dests.find(name);
+        if (fnd != dests.end()) {
+            fnd->handle = command.getSource();
+        }
+    });
+}
+
+void CommonCore::removeEndpointLocations(global_handle location)
+{
+    auto matches = [location](global_handle handle) {
+        return (handle.fed_id == location.fed_id) &&
+            (!location.handle.isValid() || handle.handle == location.handle);
+    };
+    for (auto known = knownExternalEndpoints.begin(); known != knownExternalEndpoints.end();) {
+        if (matches(known->second.first)) {
+            known = knownExternalEndpoints.erase(known);
+        } else {
+            ++known;
+        }
+    }
+    registeredDestinations.modify([&matches](auto& dests) {
+        for (auto& dest : dests) {
+            if (dest.handle.isValid() && matches(dest.handle)) {
+                // the destination goes back to being located by name
+                dest.handle = global_handle();
+                dest.local = false;
+            }
+        }
+    });
+}
+
+void CommonCore::expandCompactMessage(ActionMessage& message) const
+{
+    if (!checkActionFlag(message, compact_message_flag)) {
+        return;
+    }
+    clearActionFlag(message, compact_message_flag);
+    const auto* source = loopHandles.getEndpoint(message.source_handle);
+    const auto& sourceName = (source != nullptr) ? source->key : emptyStr;
+    if (message.getStringData().empty()) {
+        const auto* dest = loopHandles.findHandle(message.getDest());
+        message.setString(targetStringLoc, (dest != nullptr) ? dest->key : emptyStr);
+    }
+    message.setString(sourceStringLoc, sourceName);
+    message.setString(origSourceStringLoc, sourceName);
+}
+
 void CommonCore::sendMessage(interface_handle sourceHandle, std::unique_ptr<Message> message)
 {
     if (sourceHandle == direct_send_handle) {
@@ -1640,6 +1794,105 @@ void CommonCore::sendMessage(interface_handle sourceHandle, std::unique_ptr<Mess
     addActionMessage(std::move(m));
 }
 
+void CommonCore::sendBatch(Time time,
+                           interface_handle sourceHandle,
+                           const std::string* destinations,
+                           int destinationCount,
+                           const char* const* data,
+                           const uint64_t* lengths,
+                           int count)
+{
+    const auto* hndl = getHandleInfo(sourceHandle);
+    if (hndl == nullptr) {
+        throw(InvalidIdentifier("handle is not valid"));
+    }
+    if (hndl->handleType != handle_type::endpoint) {
+        throw(InvalidIdentifier("handle does not point to an endpoint"));
+    }
+    if (destinationCount != 1 && destinationCount != count) {
+        throw(InvalidParameter("the number of destinations must be 1 or the number of messages"));
+    }
+    if (count <= 0) {
+        return;
+    }
+    ActionMessage m(CMD_SEND_MESSAGE);
+    m.source_handle = sourceHandle;
+    m.source_id = hndl->getFederateId();
+    auto minTime = getFederateAt(hndl->local_fed_id)->nextAllowedSendTime();
+    m.actionTime = std::max(time, minTime);
+    if (destinationCount == 1) {
+        setMessageDestination(m, destinations[0]);
+    }
+    auto messageID = messageCounter.fetch_add(count) + 1;
+
+    ActionMessage package(CMD_MULTI_MESSAGE);
+    package.source_id = m.source_id;
+    package.source_handle = sourceHandle;
+    for (int ii = 0; ii < count; ++ii) {
+        ActionMessage mv(m);
+        if (destinationCount != 1) {
+            setMessageDestination(mv, destinations[ii]);
+        }
+        mv.payload = std::string(data[ii], lengths[ii]);
+        mv.messageID = messageID++;
+        if (count == 1) {
+            addActionMessage(std::move(mv));
+            return;
+        }
+        if (appendMessage(package, mv) < 0) {
+            // deal with the max package size
+            actionQueue.push(std::move(package));
+            package = ActionMessage(CMD_MULTI_MESSAGE);
+            package.source_id = m.source_id;
+            package.source_handle = sourceHandle;
+            appendMessage(package, mv);
+        }
+    }
+    actionQueue.push(std::move(package));
+}
+
+int32_t CommonCore::registerDestination(const std::string& destination)
+{
+    // local endpoints do not move so they are located once when the destination is registered
+    const auto* localDest = getLocalEndpoint(destination);
+    return registeredDestinations.modify([&destination, localDest](auto& dests) {
+        auto fnd = dests.find(destination);
+        if (fnd != dests.end()) {
+            return static_cast<int32_t>(std::distance(dests.begin(), fnd));
+        }
+        auto index = dests.insert(destination, destination);
+        if (localDest != nullptr) {
+            dests[*index].handle = localDest->handle;
+            dests[*index].local = true;
+        }
+        return static_cast<int32_t>(*index);
+    });
+}
+
+void CommonCore::sendToDestination(Time time,
+                                   interface_handle sourceHandle,
+                                   int32_t destination,
+                                   const char* data,
+                                   uint64_t length)
+{
+    const auto* hndl = getHandleInfo(sourceHandle);
+    if (hndl == nullptr) {
+        throw(InvalidIdentifier("handle is not valid"));
+    }
+    if (hndl->handleType != handle_type::endpoint) {
+        throw(InvalidIdentifier("handle does not point to an endpoint"));
+    }
+    ActionMessage m(CMD_SEND_MESSAGE);
+    m.source_handle = sourceHandle;
+    m.source_id = hndl->getFederateId();
+    auto minTime = getFederateAt(hndl->local_fed_id)->nextAllowedSendTime();
+    m.actionTime = std::max(time, minTime);
+    m.payload = std::string(data, length);
+    setMessageDestination(m, destination);
+    m.messageID = ++messageCounter;
+    addActionMessage(std::move(m));
+}
+
 void CommonCore::deliverMessage(ActionMessage& message)
 {
     switch (message.action()) {
@@ -1648,11 +1901,25 @@ void CommonCore::deliverMessage(ActionMessage& message)
             auto* localP = (message.dest_id == parent_broker_id) ?
                 loopHandles.getEndpoint(message.getString(targetStringLoc)) :
                 loopHandles.findHandle(message.getDest());
+            if (localP == nullptr || checkActionFlag(*localP, has_dest_filter_flag)) {
+                // the names are needed by the filters and other cores
+                expandCompactMessage(message);
+            }
             if (localP == nullptr) {
+                if (checkActionFlag(message, located_destination_flag)) {
+                    clearActionFlag(message, located_destination_flag);
+                    transmit(getRoute(message.dest_id), message);
+                    return;
+                }
                 auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
                 if (kfnd != knownExternalEndpoints.end()) {  // destination is known
-                    transmit(kfnd->second, message);
+                    message.setDestination(kfnd->second.first);
+                    transmit(kfnd->second.second, message);
                 } else {
+                    if (isLocal(message.source_id)) {
+                        // ask the broker for the location so later messages can skip the lookup
+                        setActionFlag(message, locate_destination_flag);
+                    }
                     transmit(parent_route_id, message);
                 }
                 return;
@@ -2793,6 +3060,7 @@ void CommonCore::processCommand(ActionMessage&& command)
             break;
         case CMD_BROADCAST_DISCONNECT: {
             timeCoord->processTimeMessage(command);
+            removeEndpointLocations(global_handle(command.source_id, interface_handle()));
             loopFederates.apply([&command](auto& fed) { fed->addAction(command); });
             checkAndProcessDisconnect();
         } break;
@@ -2860,6 +3128,7 @@ void CommonCore::processCommand(ActionMessage&& command)
                         return;
                     }
                     fed->state = operation_state::disconnected;
+                    removeEndpointLocations(global_handle(command.source_id, interface_handle()));
                     auto cstate = brokerState.load();
                     if ((!checkAndProcessDisconnect()) || (cstate < broker_state_t::operating)) {
                         command.setAction(CMD_DISCONNECT_FED);
@@ -3072,6 +3341,9 @@ void CommonCore::processCommand(ActionMessage&& command)
         case CMD_ADD_PUBLISHER:
             addTargetToInterface(command);
             break;
+        case CMD_ENDPOINT_LOCATION:
+            addEndpointLocation(command);
+            break;
         case CMD_REMOVE_NAMED_ENDPOINT:
         case CMD_REMOVE_NAMED_PUBLICATION:
         case CMD_REMOVE_NAMED_INPUT:
@@ -3123,7 +3395,10 @@ void CommonCore::processCommand(ActionMessage&& command)
         } break;
 
         case CMD_SEND_MESSAGE:
-            if ((command.dest_id == parent_broker_id) && (isLocal(command.source_id))) {
+            if ((command.dest_id == parent_broker_id ||
+                 checkActionFlag(command, compact_message_flag) ||
+                 checkActionFlag(command, located_destination_flag)) &&
+                (isLocal(command.source_id))) {
                 deliverMessage(processMessage(command));
             } else {
                 deliverMessage(command);
@@ -3403,6 +3678,9 @@ void CommonCore::disconnectInterface(ActionMessage& command)
         return;
     }
     setActionFlag(*handleInfo, disconnected_flag);
+    if (handleInfo->handleType == handle_type::endpoint) {
+        removeEndpointLocations(handleInfo->handle);
+    }
     if (handleInfo->getFederateId() == global_broker_id_local) {
         // DO something with filters
         auto* filt = filters.find(command.getSource());
@@ -4116,12 +4394,15 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
         return m;
     }
     if (checkActionFlag(*handle, has_source_filter_flag)) {
+        expandCompactMessage(m);
         auto* filtFunc = getFilterCoordinator(handle->getInterfaceHandle());
         if (filtFunc->hasSourceFilters) {
-            //   for (int ii = 0; ii < static_cast<int> (filtFunc->sourceFilters.size ()); ++ii)
-            size_t ii = 0;
-            for (auto& filt : filtFunc->sourceFilters) {
+            const auto filterCount = filtFunc->sourceFilters.size();
+            std::size_t ii = 0;
+            while (ii < filterCount) {
+                auto* filt = filtFunc->sourceFilters[ii];
                 if (checkActionFlag(*filt, disconnected_flag)) {
+                    ++ii;
                     continue;
                 }
                 if (filt->core_id == global_broker_id_local) {
@@ -4135,15 +4416,11 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
                                 deliverMessage(cmd);
                             }
                         }
+                        ++ii;
                     } else {
                         // deal with local source filters
-                        auto tempMessage = createMessageFromCommand(std::move(m));
-                        tempMessage = filt->filterOp->process(std::move(tempMessage));
-                        if (tempMessage) {
-                            m = ActionMessage(std::move(tempMessage));
-                        } else {
-                            // the filter dropped the message;
-                            m = CMD_IGNORE;
+                        ii = applyLocalSourceFilters(m, *filtFunc, ii);
+                        if (m.action() == CMD_IGNORE) {
                             return m;
                         }
                     }
@@ -4154,11 +4431,12 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
                     cloneMessage.dest_id = filt->core_id;
                     cloneMessage.dest_handle = filt->handle;
                     routeMessage(cloneMessage);
+                    ++ii;
                 } else {
                     m.dest_id = filt->core_id;
                     m.dest_handle = filt->handle;
                     m.counter = static_cast<uint16_t>(ii);
-                    if (ii < filtFunc->sourceFilters.size() - 1) {
+                    if (ii < filterCount - 1) {
                         m.setAction(CMD_SEND_FOR_FILTER_AND_RETURN);
                         ongoingFilterProcesses[handle->getFederateId().baseValue()].insert(
                             m.messageID);
@@ -4167,7 +4445,6 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
                     }
                     return m;
                 }
-                ++ii;
             }
         }
     }
@@ -4175,6 +4452,34 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
     return m;
 }
 
+std::size_t CommonCore::applyLocalSourceFilters(ActionMessage& message,
+                                                const FilterCoordinator& filtFunc,
+                                                std::size_t index)
+{
+    const auto& sourceFilters = filtFunc.sourceFilters;
+    auto tempMessage = createMessageFromCommand(std::move(message));
+    for (; index < sourceFilters.size(); ++index) {
+        const auto* filt = sourceFilters[index];
+        if (checkActionFlag(*filt, disconnected_flag)) {
+            continue;
+        }
+        if (filt->core_id != global_broker_id_local || filt->cloning) {
+            break;
+        }
+        if (!filt->filterOp) {
+            continue;
+        }
+        tempMessage = filt->filterOp->process(std::move(tempMessage));
+        if (!tempMessage) {
+            // the filter dropped the message
+            message = CMD_IGNORE;
+            return sourceFilters.size();
+        }
+    }
+    message = ActionMessage(std::move(tempMessage));
+    return index;
+}
+
 void CommonCore::processDestFilterReturn(ActionMessage& command)
 {
     auto* handle = loopHandles.getEndpoint(command.dest_handle);
@@ -4249,21 +4554,19 @@ void CommonCore::processFilterReturn(ActionMessage& cmd)
         }
         auto* filtFunc = getFilterCoordinator(handle->getInterfaceHandle());
         if (filtFunc->hasSourceFilters) {
-            for (auto ii = static_cast<size_t>(cmd.counter) + 1;
-                 ii < filtFunc->sourceFilters.size();
-                 ++ii) {
+            const auto filterCount = filtFunc->sourceFilters.size();
+            auto ii = static_cast<std::size_t>(cmd.counter) + 1;
+            while (ii < filterCount) {
                 // cloning filters come first so we don't need to check for them in this code branch
                 auto* filt = filtFunc->sourceFilters[ii];
                 if (checkActionFlag(*filt, disconnected_flag)) {
+                    ++ii;
                     continue;
                 }
                 if (filt->core_id == global_broker_id_local) {
                     // deal with local source filters
-                    auto tempMessage = createMessageFromCommand(std::move(cmd));
-                    tempMessage = filt->filterOp->process(std::move(tempMessage));
-                    if (tempMessage) {
-                        cmd = ActionMessage(std::move(tempMessage));
-                    } else {
+                    ii = applyLocalSourceFilters(cmd, *filtFunc, ii);
+                    if (cmd.action() == CMD_IGNORE) {
                         ongoingFilterProcesses[fid_index].erase(messID);
                         if (ongoingFilterProcesses[fid_index].empty()) {
                             transmitDelayedMessages(fid);
@@ -4274,7 +4577,7 @@ void CommonCore::processFilterReturn(ActionMessage& cmd)
                     cmd.dest_id = filt->core_id;
                     cmd.dest_handle = filt->handle;
                     cmd.counter = static_cast<uint16_t>(ii);
-                    if (ii < filtFunc->sourceFilters.size() - 1) {
+                    if (ii < filterCount - 1) {
                         cmd.setAction(CMD_SEND_FOR_FILTER_AND_RETURN);
                     } else {
                         cmd.setAction(CMD_SEND_FOR_FILTER);
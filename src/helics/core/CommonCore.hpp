@@ -12,12 +12,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BrokerBase.hpp"
 #include "Core.hpp"
 #include "HandleManager.hpp"
+#include "RoutingTable.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/containers/AirLock.hpp"
 #include "gmlc/containers/DualMappedPointerVector.hpp"
 #include "gmlc/containers/DualMappedVector.hpp"
 #include "gmlc/containers/MappedPointerVector.hpp"
+#include "gmlc/containers/MappedVector.hpp"
 #include "gmlc/containers/SimpleQueue.hpp"
 #include "helics-time.hpp"
 #include "helics/external/any.hpp"
@@ -32,6 +34,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace helics {
@@ -62,6 +65,16 @@ class FedInfo {
     operator bool() const noexcept { return (fed != nullptr); }
 };
 
+/** helper class containing a named message destination registered with the core*/
+class DestinationInfo {
+  public:
+    std::string name;  //!< the name of the destination endpoint
+    global_handle handle;  //!< the handle of the endpoint once it has been located
+    bool local{false};  //!< indicator that the endpoint is part of the core
+
+    explicit DestinationInfo(std::string destName): name(std::move(destName)) {}
+};
+
 /** base class implementing a standard interaction strategy between federates
 @details the CommonCore is virtual class that manages local federates and handles most of the
 interaction between federate it is meant to be instantiated for specific inter-federate
@@ -151,6 +164,10 @@ class CommonCore: public Core, public BrokerBase {
     virtual const std::string& getInjectionType(interface_handle handle) const override final;
     virtual const std::string& getExtractionType(interface_handle handle) const override final;
     virtual void setValue(interface_handle handle, const char* data, uint64_t len) override final;
+    virtual void setValues(const interface_handle* pubHandles,
+                           const char* data,
+                           const uint64_t* offsets,
+                           int count) override final;
     virtual const std::shared_ptr<const data_block>& getValue(interface_handle handle,
                                                               uint32_t* inputIndex) override final;
     virtual const std::vector<std::shared_ptr<const data_block>>&
@@ -190,6 +207,19 @@ class CommonCore: public Core, public BrokerBase {
                            uint64_t length) override final;
     virtual void sendMessage(interface_handle sourceHandle,
                              std::unique_ptr<Message> message) override final;
+    virtual void sendBatch(Time time,
+                           interface_handle sourceHandle,
+                           const std::string* destinations,
+                           int destinationCount,
+                           const char* const* data,
+                           const uint64_t* lengths,
+                           int count) override final;
+    virtual int32_t registerDestination(const std::string& destination) override final;
+    virtual void sendToDestination(Time time,
+                                   interface_handle sourceHandle,
+                                   int32_t destination,
+                                   const char* data,
+                                   uint64_t length) override final;
     virtual uint64_t receiveCount(interface_handle destination) override final;
     virtual std::unique_ptr<Message> receive(interface_handle destination) override final;
     virtual std::unique_ptr<Message> receiveAny(local_federate_id federateID,
@@ -299,14 +329,12 @@ class CommonCore: public Core, public BrokerBase {
 
   private:
     std::string prevIdentifier;  //!< storage for the case of requiring a renaming
-    std::map<global_federate_id, route_id>
-        routing_table;  //!< map for external routes  <global federate id, route id>
+    RoutingTable routing_table;  //!< map for external routes  <global federate id, route id>
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue;  //!< FIFO queue for transmissions to the root that need to be delayed
                              //!< for a certain time
-    std::unordered_map<std::string, route_id>
-        knownExternalEndpoints;  //!< external map for all known external endpoints with names and
-                                 //!< route
+    /// external map for all known external endpoints with names and their handle and route
+    std::unordered_map<std::string, std::pair<global_handle, route_id>> knownExternalEndpoints;
 
     std::unique_ptr<TimeoutMonitor>
         timeoutMon;  //!< class to handle timeouts and disconnection notices
@@ -389,6 +417,9 @@ class CommonCore: public Core, public BrokerBase {
     //!< confusion
 
     ordered_guarded<HandleManager> handles;  //!< local handle information;
+    /// the destinations registered for repeated sends
+    ordered_guarded<gmlc::containers::MappedVector<DestinationInfo, std::string>>
+        registeredDestinations;
     HandleManager loopHandles;  //!< copy of handles to use in the primary processing loop without
                                 //!< thread protection
     std::map<int32_t, std::set<int32_t>>
@@ -423,6 +454,33 @@ class CommonCore: public Core, public BrokerBase {
     void deliverMessage(ActionMessage& message);
     /** function to deal with a source filters*/
     ActionMessage& processMessage(ActionMessage& message);
+    /** apply the consecutive local source filters of an endpoint to a message
+    @details the message is converted for the filter operators once for the whole sequence and the
+    operators are run back to back on the same message object
+    @param message the message to filter,  it is set to CMD_IGNORE if a filter drops it
+    @param filtFunc the filter coordinator of the source endpoint
+    @param index the index of the first filter to apply
+    @return the index of the first source filter which was not applied*/
+    std::size_t applyLocalSourceFilters(ActionMessage& message,
+                                        const FilterCoordinator& filtFunc,
+                                        std::size_t index);
+    /** set the destination of a message by name
+    @details the names of the source are left out of the message and only filled in by
+    expandCompactMessage if the message needs them*/
+    static void setMessageDestination(ActionMessage& message, const std::string& destination);
+    /** set the destination of a message from a registered destination
+    @details destinations which have been located are addressed by handle,  the destination name is
+    also left out of messages to endpoints of this core*/
+    void setMessageDestination(ActionMessage& message, int32_t destination);
+    /** store the location of a named endpoint sent from a broker
+    @details a location with the disconnected flag removes the stored locations instead*/
+    void addEndpointLocation(const ActionMessage& command);
+    /** remove the stored locations of an endpoint,  or of all the endpoints of a federate if the
+    interface handle is not valid*/
+    void removeEndpointLocations(global_handle location);
+    /** fill in the names of a message addressed by handles
+    @details needed before a message is processed by filters or leaves the core*/
+    void expandCompactMessage(ActionMessage& message) const;
     /** add a new handle to the generic structure
     and return a reference to the basicHandle
     */
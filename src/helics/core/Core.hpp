@@ -461,6 +461,22 @@ class Core {
      */
     virtual void setValue(interface_handle handle, const char* data, uint64_t len) = 0;
 
+    /**
+     * Publish values for several publications in a single call.
+     *
+     @details the behavior is the same as calling setValue for each handle but the updates going
+     to the same destination are packaged into a single command
+     @param handles the publication handles
+     @param data a buffer containing the data for all the values
+     @param offsets the location of each value in the data buffer, the value for handles[ii] is
+     from offsets[ii] to offsets[ii+1] so the array must contain count+1 elements
+     @param count the number of handles
+     */
+    virtual void setValues(const interface_handle* handles,
+                           const char* data,
+                           const uint64_t* offsets,
+                           int count) = 0;
+
     /**
      * Return the data for the specified handle or the latest input
      * @param handle the input handle from which to get the data
@@ -649,6 +665,56 @@ class Core {
      */
     virtual void sendMessage(interface_handle sourceHandle, std::unique_ptr<Message> message) = 0;
 
+    /**
+     * Send several messages from a single endpoint in one call.
+     *
+     @details the behavior is the same as calling sendEvent for each message but the messages are
+     packaged into as few commands as possible for the core
+     @param time the time the messages are scheduled for,  the time is limited to the next time
+     the federate is allowed to send so Time::minVal() sends the messages as soon as possible
+     @param sourceHandle the endpoint the messages come from
+     @param destinations the destinations of the messages
+     @param destinationCount the number of destinations,  either 1 to send all the messages to
+     the same destination or count to give each message its own destination
+     @param data an array of pointers to the data of each message
+     @param lengths an array of the lengths of the data of each message
+     @param count the number of messages
+     */
+    virtual void sendBatch(Time time,
+                           interface_handle sourceHandle,
+                           const std::string* destinations,
+                           int destinationCount,
+                           const char* const* data,
+                           const uint64_t* lengths,
+                           int count) = 0;
+
+    /**
+     * Get an identifier for a named message destination.
+     *
+     @details once the core has located the destination messages sent through the identifier are
+     addressed by handle instead of by name
+     @param destination the name of the destination endpoint
+     @return an identifier for use with sendToDestination,  registering the same name again
+     returns the same identifier
+     */
+    virtual int32_t registerDestination(const std::string& destination) = 0;
+
+    /**
+     * Send data to a destination obtained from registerDestination.
+     *
+     @param time the time the message is scheduled for,  the time is limited to the next time
+     the federate is allowed to send so Time::minVal() sends the message as soon as possible
+     @param sourceHandle the endpoint the message comes from
+     @param destination the identifier of the destination
+     @param data the raw data for the message
+     @param length the length of the data
+     */
+    virtual void sendToDestination(Time time,
+                                   interface_handle sourceHandle,
+                                   int32_t destination,
+                                   const char* data,
+                                   uint64_t length) = 0;
+
     /**
      * Returns the number of pending receives for the specified destination endpoint.
      */
@@ -19,6 +19,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "loggingHelper.hpp"
 #include "queryHelpers.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -79,9 +80,7 @@ route_id CoreBroker::getRoute(global_federate_id fedid) const
     if ((fedid == parent_broker_id) || (fedid == higher_broker_id)) {
         return parent_route_id;
     }
-    auto fnd = routing_table.find(fedid);
-    return (fnd != routing_table.end()) ? fnd->second :
-                                          parent_route_id;  // zero is the default route
+    return routing_table.getRoute(fedid);  // zero is the default route
 }
 
 BasicBrokerInfo* CoreBroker::getBrokerById(global_broker_id brokerid)
@@ -207,6 +206,21 @@ route_id CoreBroker::fillMessageRouteInformation(ActionMessage& mess)
     return parent_route_id;
 }
 
+void CoreBroker::removeEndpointLocations(global_handle location)
+{
+    auto fnd = locatedFederates.find(location.fed_id);
+    if (fnd == locatedFederates.end()) {
+        return;
+    }
+    if (!location.handle.isValid()) {
+        locatedFederates.erase(fnd);
+    }
+    ActionMessage removal(CMD_ENDPOINT_LOCATION);
+    removal.setSource(location);
+    setActionFlag(removal, disconnected_flag);
+    broadcast(removal);
+}
+
 bool CoreBroker::isOpenToNewFederates() const
 {
     auto cstate = brokerState.load();
@@ -332,7 +346,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                     addRoute(brk->route,
                              command.getExtraData(),
                              command.getString(targetStringLoc));
-                    routing_table[brk->global_id] = brk->route;
+                    routing_table.setRoute(brk->global_id, brk->route);
 
                     // sending the response message
                     ActionMessage brokerReply(CMD_BROKER_ACK);
@@ -974,6 +988,7 @@ void CoreBroker::processCommand(ActionMessage&& command)
             if (fed != _federates.end()) {
                 fed->state = connection_state::disconnected;
             }
+            removeEndpointLocations(global_handle(command.source_id, interface_handle()));
             if (!isRootc) {
                 transmit(parent_route_id, command);
             } else if (brokerState < broker_state_t::operating) {
@@ -1052,6 +1067,18 @@ void CoreBroker::processCommand(ActionMessage&& command)
         case CMD_NULL_MESSAGE:
             if (command.dest_id == parent_broker_id) {
                 auto route = fillMessageRouteInformation(command);
+                if (command.dest_id != parent_broker_id &&
+                    checkActionFlag(command, locate_destination_flag)) {
+                    // the sending core does not know the endpoint so let it address later
+                    // messages to the endpoint directly
+                    clearActionFlag(command, locate_destination_flag);
+                    ActionMessage location(CMD_ENDPOINT_LOCATION);
+                    location.setSource(command.getDest());
+                    location.dest_id = command.source_id;
+                    location.name = command.getString(targetStringLoc);
+                    routeMessage(std::move(location));
+                    locatedFederates.insert(command.dest_id);
+                }
                 transmit(route, command);
             } else {
                 transmit(getRoute(command.dest_id), command);
@@ -1107,6 +1134,20 @@ void CoreBroker::processCommand(ActionMessage&& command)
                 break;
             }
             handles.removeHandle(command.getSource());
+            if (command.messageID == static_cast<int32_t>(handle_type::endpoint)) {
+                removeEndpointLocations(command.getSource());
+            }
+            if (!isRootc) {
+                transmit(parent_route_id, command);
+            }
+            break;
+        case CMD_ENDPOINT_LOCATION:
+            if (command.dest_id != global_broker_id_local) {
+                routeMessage(command);
+            } else if (checkActionFlag(command, disconnected_flag)) {
+                // pass the removal of endpoint locations along to the cores
+                broadcast(command);
+            }
             break;
         case CMD_ADD_DEPENDENCY:
         case CMD_REMOVE_DEPENDENCY:
@@ -1879,6 +1920,7 @@ void CoreBroker::broadcast(ActionMessage& cmd)
 
 void CoreBroker::executeInitializationOperations()
 {
+    auto initStart = std::chrono::steady_clock::now();
     if (brokerKey == universalKey) {
         LOG_SUMMARY(global_broker_id_local, getIdentifier(), " Broker started with universal key");
     }
@@ -1986,6 +2028,11 @@ void CoreBroker::executeInitializationOperations()
     if (res == message_processing_result::next_step) {
         enteredExecutionMode = true;
     }
+    auto initTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - initStart);
+    LOG_TIMING(global_broker_id_local,
+               getIdentifier(),
+               fmt::format("initialization operations completed in {} us", initTime.count()));
     logFlush();
 }
 
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Broker.hpp"
 #include "BrokerBase.hpp"
 #include "HandleManager.hpp"
+#include "RoutingTable.hpp"
 #include "TimeDependencies.hpp"
 #include "UnknownHandleManager.hpp"
 #include "federate_id_extra.hpp"
@@ -31,6 +32,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -110,11 +112,12 @@ class CoreBroker: public Broker, public BrokerBase {
         delayedDependencies;  //!< set of dependencies that need to be created on init
     std::unordered_map<global_federate_id, local_federate_id>
         global_id_translation;  //!< map to translate global ids to local ones
-    std::unordered_map<global_federate_id, route_id>
-        routing_table;  //!< map for external routes  <global federate id, route id>
+    RoutingTable routing_table;  //!< map for external routes  <global federate id, route id>
     std::unordered_map<std::string, route_id>
         knownExternalEndpoints;  //!< external map for all known external endpoints with names and
                                  //!< route
+    /// the federates with endpoints whose locations have been sent to cores
+    std::unordered_set<global_federate_id> locatedFederates;
     std::unordered_map<std::string, std::string> global_values;  //!< storage for global values
     std::mutex name_mutex_;  //!< mutex lock for name and identifier
     std::atomic<int> queryCounter{1};  // counter for active queries going to the local API
@@ -166,6 +169,9 @@ class CoreBroker: public Broker, public BrokerBase {
     void broadcast(ActionMessage& cmd);
     /**/
     route_id fillMessageRouteInformation(ActionMessage& mess);
+    /** tell the cores to drop the locations of an endpoint,  or of all the endpoints of a federate
+    if the interface handle is not valid*/
+    void removeEndpointLocations(global_handle location);
 
     /** handle initialization operations*/
     void executeInitializationOperations();
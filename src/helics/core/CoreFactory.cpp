@@ -18,8 +18,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/helics-config.h"
 #include "helicsCLI11.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <future>
+#include <mutex>
 #include <tuple>
 #include <utility>
 
@@ -87,6 +90,176 @@ namespace CoreFactory {
         return MasterCoreBuilder::getBuilder(static_cast<int>(type))->build(name);
     }
 
+    /** shutdown a core that was configured but never connected*/
+    static void shutdownPooledCore(std::shared_ptr<Core>& core)
+    {
+        auto* ccore = dynamic_cast<CommonCore*>(core.get());
+        if (ccore != nullptr) {
+            ccore->processDisconnect(true);
+            ccore->joinAllThreads();
+        }
+        core.reset();
+    }
+
+    /** class holding sets of configured cores ready to be handed out by create*/
+    class CorePool {
+      public:
+        CorePool()
+        {
+            // make sure the builders outlive the pool since the pool uses them to refill
+            MasterCoreBuilder::instance();
+        }
+        ~CorePool() { clear(); }
+        /** set the target size of the pool for a type and configuration*/
+        void setPool(core_type type, const std::string& configureString, int poolSize)
+        {
+            std::vector<std::shared_ptr<Core>> extraCores;
+            {
+                std::lock_guard<std::mutex> lock(poolLock);
+                auto* entry = findEntry(type, configureString);
+                if (entry == nullptr) {
+                    if (poolSize <= 0) {
+                        return;
+                    }
+                    pools.push_back(std::make_unique<PoolEntry>());
+                    entry = pools.back().get();
+                    entry->type = type;
+                    entry->configureString = configureString;
+                }
+                entry->targetSize = static_cast<std::size_t>(std::max(poolSize, 0));
+                while (entry->cores.size() > entry->targetSize) {
+                    extraCores.push_back(std::move(entry->cores.back()));
+                    entry->cores.pop_back();
+                }
+                startFill(*entry);
+            }
+            for (auto& core : extraCores) {
+                shutdownPooledCore(core);
+            }
+        }
+        /** get a core from the pool if one is available*/
+        std::shared_ptr<Core> getCore(core_type type, const std::string& configureString)
+        {
+            std::lock_guard<std::mutex> lock(poolLock);
+            if (pools.empty()) {
+                return nullptr;
+            }
+            auto* entry = findEntry(type, configureString);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            std::shared_ptr<Core> core;
+            if (!entry->cores.empty()) {
+                core = std::move(entry->cores.back());
+                entry->cores.pop_back();
+            }
+            startFill(*entry);
+            return core;
+        }
+        /** get the number of cores of a type ready in the pools*/
+        std::size_t count(core_type type)
+        {
+            std::lock_guard<std::mutex> lock(poolLock);
+            std::size_t cnt{0};
+            for (auto& entry : pools) {
+                if (entry->type == type) {
+                    cnt += entry->cores.size();
+                }
+            }
+            return cnt;
+        }
+        /** shutdown all the pooled cores and stop any refills*/
+        void clear()
+        {
+            std::vector<std::future<void>> fillers;
+            {
+                std::lock_guard<std::mutex> lock(poolLock);
+                for (auto& entry : pools) {
+                    entry->targetSize = 0;
+                    if (entry->filler.valid()) {
+                        fillers.push_back(std::move(entry->filler));
+                    }
+                }
+            }
+            for (auto& filler : fillers) {
+                filler.wait();
+            }
+            std::vector<std::unique_ptr<PoolEntry>> oldPools;
+            {
+                std::lock_guard<std::mutex> lock(poolLock);
+                oldPools.swap(pools);
+            }
+            for (auto& entry : oldPools) {
+                for (auto& core : entry->cores) {
+                    shutdownPooledCore(core);
+                }
+            }
+        }
+
+      private:
+        struct PoolEntry {
+            core_type type{core_type::DEFAULT};
+            std::string configureString;
+            std::size_t targetSize{0};
+            bool filling{false};
+            std::vector<std::shared_ptr<Core>> cores;
+            std::future<void> filler;
+        };
+        PoolEntry* findEntry(core_type type, const std::string& configureString)
+        {
+            for (auto& entry : pools) {
+                if (entry->type == type && entry->configureString == configureString) {
+                    return entry.get();
+                }
+            }
+            return nullptr;
+        }
+        /** start a background refill of a pool entry, must be called with the lock held*/
+        void startFill(PoolEntry& entry)
+        {
+            if (entry.filling || entry.cores.size() >= entry.targetSize) {
+                return;
+            }
+            entry.filling = true;
+            if (entry.filler.valid()) {
+                // the previous fill has already released the lock so this will not block long
+                entry.filler.wait();
+            }
+            entry.filler = std::async(std::launch::async, [this, &entry]() { fill(entry); });
+        }
+        /** build and configure cores until the entry is at its target size*/
+        void fill(PoolEntry& entry)
+        {
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> lock(poolLock);
+                    if (entry.cores.size() >= entry.targetSize) {
+                        entry.filling = false;
+                        return;
+                    }
+                }
+                std::shared_ptr<Core> core;
+                try {
+                    core = makeCore(entry.type, emptyString);
+                    core->configure(entry.configureString);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(poolLock);
+                    // a configuration that fails will keep failing so stop trying to fill
+                    entry.targetSize = entry.cores.size();
+                    entry.filling = false;
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(poolLock);
+                entry.cores.push_back(std::move(core));
+            }
+        }
+        std::mutex poolLock;  //!< lock protecting the pool entries
+        std::vector<std::unique_ptr<PoolEntry>> pools;  //!< the sets of pooled cores
+    };
+
+    static CorePool corePool;  //!< the object holding the pooled cores
+
     std::shared_ptr<Core> create(const std::string& initializationString)
     {
         helicsCLI11App tparser;
@@ -105,7 +278,12 @@ namespace CoreFactory {
     std::shared_ptr<Core>
         create(core_type type, const std::string& coreName, const std::string& configureString)
     {
-        auto core = makeCore(type, coreName);
+        auto core = (coreName.empty()) ? corePool.getCore(type, configureString) : nullptr;
+        if (core) {
+            registerCore(core, type);
+            return core;
+        }
+        core = makeCore(type, coreName);
         if (!core) {
             throw(helics::RegistrationFailure("unable to create core"));
         }
@@ -308,8 +486,18 @@ thread which allows the destructor to fire if need be without issue*/
         return delayedDestroyer.destroyObjects(delay);
     }
 
+    void setCorePool(core_type type, const std::string& configureString, int poolSize)
+    {
+        corePool.setPool(type, configureString, poolSize);
+    }
+
+    size_t getPooledCoreCount(core_type type) { return corePool.count(type); }
+
+    void clearCorePools() { corePool.clear(); }
+
     void terminateAllCores()
     {
+        corePool.clear();
         auto cores = searchableCores.getObjects();
         for (auto& cr : cores) {
             cr->disconnect();
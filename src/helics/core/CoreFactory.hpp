@@ -178,6 +178,23 @@ Core is registered or when the clean up function is called this prevents some od
  */
     bool copyCoreIdentifier(const std::string& copyFromName, const std::string& copyToName);
 
+    /** keep a pool of configured cores ready for use by new federates
+@details calls to create with no core name and a type and configuration string matching a pool are
+served from the pool instead of building and configuring a new core,  the pool is refilled in the
+background so repeated federation lifecycles do not pay the core setup cost on the critical path
+@param type the type of core to hold in the pool
+@param configureString the configuration string used for the pooled cores,  it should not
+include a core name
+@param poolSize the number of cores to keep ready,  0 removes any existing pooled cores
+*/
+    void setCorePool(core_type type, const std::string& configureString, int poolSize);
+
+    /** get the number of cores of a particular type ready for use in the core pools*/
+    size_t getPooledCoreCount(core_type type);
+
+    /** shutdown and remove all cores held in the core pools*/
+    void clearCorePools();
+
     /** display the help listing for a particular core_type*/
     void displayHelp(core_type type = core_type::UNRECOGNIZED);
 
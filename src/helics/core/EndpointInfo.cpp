@@ -7,21 +7,101 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "EndpointInfo.hpp"
 //#include "core/core-data.hpp"
 
+#include "helics_definitions.hpp"
+
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <memory>
 #include <utility>
 
 namespace helics {
+/** fill in the source names of a message addressed by the handle of its source*/
+static void fillSourceNames(Message& message, const EndpointInfo::SourceNameLookup& sourceNames)
+{
+    if (!message.source_handle.isValid()) {
+        return;
+    }
+    if (sourceNames) {
+        message.source = sourceNames(message.source_handle);
+        message.original_source = message.source;
+    }
+    message.source_handle = interface_handle();
+}
+
+/** generate the function which determines message order
+@details the source names are only needed for messages with the same time so they are filled in
+here if they were not already*/
+static auto msgSorter(const EndpointInfo::SourceNameLookup& sourceNames)
+{
+    return [&sourceNames](const auto& m1, const auto& m2) {
+        // first by time
+        if (m1->time != m2->time) {
+            return (m1->time < m2->time);
+        }
+        fillSourceNames(*m1, sourceNames);
+        fillSourceNames(*m2, sourceNames);
+        return (m1->original_source < m2->original_source);
+    };
+}
+
+/** sort the messages added out of order and merge them into the ordered part of the queue
+@details the merge is stable and the ordered messages arrived first so messages that compare
+equal stay in the order they were added,  only the part of the queue after the position of the
+earliest new message is touched*/
+template<class Store>
+static void orderMessages(Store& store, const EndpointInfo::SourceNameLookup& sourceNames)
+{
+    auto& queue = store.messages;
+    if (store.orderedCount == queue.size()) {
+        return;
+    }
+    auto mid = queue.begin() + static_cast<std::ptrdiff_t>(store.orderedCount);
+    auto sorter = msgSorter(sourceNames);
+    std::stable_sort(mid, queue.end(), sorter);
+    auto start = std::upper_bound(queue.begin(), mid, *mid, sorter);
+    std::inplace_merge(start, mid, queue.end(), sorter);
+    store.orderedCount = queue.size();
+}
+
+/** run a read operation on the ordered queue
+@details only a shared lock is needed if no messages were added out of order since the last
+read*/
+template<class Guarded, class Operation>
+static auto readOrdered(Guarded& guardedQueue,
+                        const EndpointInfo::SourceNameLookup& sourceNames,
+                        Operation operation)
+{
+    {
+        auto handle = guardedQueue.lock_shared();
+        if (handle->orderedCount == handle->messages.size()) {
+            return operation(handle->messages);
+        }
+    }
+    auto handle = guardedQueue.lock();
+    orderMessages(*handle, sourceNames);
+    return operation(handle->messages);
+}
+
 std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 {
     auto handle = message_queue.lock();
-    if (handle->empty()) {
+    orderMessages(*handle, sourceNames);
+    auto& queue = handle->messages;
+    if (queue.empty()) {
         return nullptr;
     }
-    if (handle->front()->time <= maxTime) {
-        auto msg = std::move(handle->front());
-        handle->pop_front();
+    if (queue.front()->time <= maxTime) {
+        auto msg = std::move(queue.front());
+        queue.pop_front();
+        --handle->orderedCount;
+        if (msg->source_handle.isValid()) {
+            // messages addressed by handle get their names when they are retrieved
+            if (msg->dest.empty()) {
+                msg->dest = key;
+            }
+            fillSourceNames(*msg, sourceNames);
+        }
         return msg;
     }
     return nullptr;
@@ -29,39 +109,136 @@ std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 
 Time EndpointInfo::firstMessageTime() const
 {
-    auto handle = message_queue.lock_shared();
-    return (handle->empty()) ? Time::maxVal() : handle->front()->time;
+    return readOrdered(message_queue, sourceNames, [](const auto& queue) {
+        return (queue.empty()) ? Time::maxVal() : queue.front()->time;
+    });
 }
-// this is the function which determines message order
-static auto msgSorter = [](const auto& m1, const auto& m2) {
-    // first by time
-    return (m1->time != m2->time) ? (m1->time < m2->time) :
-                                    (m1->original_source < m2->original_source);
-};
 
 void EndpointInfo::addMessage(std::unique_ptr<Message> message)
 {
     auto handle = message_queue.lock();
-    handle->push_back(std::move(message));
-    std::stable_sort(handle->begin(), handle->end(), msgSorter);
+    auto& queue = handle->messages;
+    if (handle->capacity > 0 && queue.size() >= static_cast<std::size_t>(handle->capacity)) {
+        switch (handle->overflowPolicy) {
+            case defs::queue_overflow::drop_newest:
+                ++handle->dropped;
+                return;
+            case defs::queue_overflow::drop_oldest:
+            default:
+                orderMessages(*handle, sourceNames);
+                while (queue.size() >= static_cast<std::size_t>(handle->capacity)) {
+                    queue.pop_front();
+                    --handle->orderedCount;
+                    ++handle->dropped;
+                }
+                break;
+        }
+    }
+    // messages arriving in order are appended,  others are sorted when the queue is next read,
+    // messages with the same time as the last one which may need the source name are sorted later
+    const bool inOrder = (handle->orderedCount == queue.size()) &&
+        (queue.empty() || queue.back()->time < message->time ||
+         (queue.back()->time == message->time && !message->source_handle.isValid() &&
+          !queue.back()->source_handle.isValid() &&
+          queue.back()->original_source <= message->original_source));
+    queue.push_back(std::move(message));
+    if (inOrder) {
+        ++handle->orderedCount;
+    }
 }
 
 void EndpointInfo::clearQueue()
 {
-    message_queue.lock()->clear();
+    auto handle = message_queue.lock();
+    handle->messages.clear();
+    handle->orderedCount = 0;
+    handle->held = 0;
+}
+
+void EndpointInfo::setQueueCapacity(int32_t capacity)
+{
+    message_queue.lock()->capacity = (capacity > 0) ? capacity : 0;
+}
+
+int32_t EndpointInfo::getQueueCapacity() const
+{
+    return message_queue.lock_shared()->capacity;
+}
+
+void EndpointInfo::setOverflowPolicy(int32_t policy)
+{
+    message_queue.lock()->overflowPolicy = policy;
+}
+
+int32_t EndpointInfo::getOverflowPolicy() const
+{
+    return message_queue.lock_shared()->overflowPolicy;
+}
+
+uint64_t EndpointInfo::droppedCount() const
+{
+    return message_queue.lock_shared()->dropped;
+}
+
+int32_t EndpointInfo::totalQueueSize() const
+{
+    return static_cast<int32_t>(message_queue.lock_shared()->messages.size());
 }
 
 int32_t EndpointInfo::queueSize(Time maxTime) const
 {
-    auto handle = message_queue.lock_shared();
-    int32_t cnt = 0;
-    for (auto& msg : *handle) {
-        if (msg->time <= maxTime) {
-            ++cnt;
-        } else {
-            break;
+    return readOrdered(message_queue, sourceNames, [maxTime](const auto& queue) {
+        auto last = std::upper_bound(queue.begin(),
+                                     queue.end(),
+                                     maxTime,
+                                     [](Time tm, const auto& msg) { return tm < msg->time; });
+        return static_cast<int32_t>(std::distance(queue.begin(), last));
+    });
+}
+held_message_action EndpointInfo::holdMessage()
+{
+    auto handle = message_queue.lock();
+    auto& queue = handle->messages;
+    if (handle->capacity <= 0 ||
+        queue.size() + static_cast<std::size_t>(handle->held) <
+            static_cast<std::size_t>(handle->capacity)) {
+        ++handle->held;
+        return held_message_action::hold;
+    }
+    ++handle->dropped;
+    if (handle->overflowPolicy == defs::queue_overflow::drop_newest) {
+        return held_message_action::discard;
+    }
+    if (queue.empty()) {
+        // all the messages are held so the oldest of them is replaced
+        return held_message_action::replace_oldest;
+    }
+    // the queued messages are all older than the held ones
+    orderMessages(*handle, sourceNames);
+    queue.pop_front();
+    --handle->orderedCount;
+    ++handle->held;
+    return held_message_action::hold;
+}
+
+void EndpointInfo::addHeldMessage(std::unique_ptr<Message> message)
+{
+    {
+        auto handle = message_queue.lock();
+        if (handle->held > 0) {
+            --handle->held;
         }
     }
-    return cnt;
+    addMessage(std::move(message));
+}
+
+int32_t EndpointInfo::heldCount() const
+{
+    return message_queue.lock_shared()->held;
+}
+
+void EndpointInfo::setSourceNameLookup(SourceNameLookup lookup)
+{
+    sourceNames = std::move(lookup);
 }
 }  // namespace helics
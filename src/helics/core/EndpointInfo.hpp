@@ -9,10 +9,20 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/GuardedTypes.hpp"
 #include "basic_core_types.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 namespace helics {
+/** the action to take with a message held for a later time before it goes in the queue*/
+enum class held_message_action {
+    hold,  //!< hold the message
+    discard,  //!< discard the message
+    replace_oldest  //!< discard the oldest held message and hold the new one
+};
+
 /** data class containing the information about an endpoint*/
 class EndpointInfo {
   public:
@@ -25,9 +35,23 @@ class EndpointInfo {
     const global_handle id;  //!< identifier for the handle
     const std::string key;  //!< name of the endpoint
     const std::string type;  //!< type of the endpoint
+    /** function returning the name of an endpoint in the same core from its handle*/
+    using SourceNameLookup = std::function<const std::string&(interface_handle)>;
+
   private:
-    shared_guarded<std::deque<std::unique_ptr<Message>>>
-        message_queue;  //!< storage for the messages
+    /** message storage where only the front part is known to be in order*/
+    struct MessageStore {
+        std::deque<std::unique_ptr<Message>> messages;  //!< the queued messages
+        std::size_t orderedCount{0};  //!< the number of messages at the front in order
+        int32_t capacity{0};  //!< the maximum number of messages in the queue, 0 for no limit
+        int32_t overflowPolicy{0};  //!< the action taken when a message arrives at a full queue
+        uint64_t dropped{0};  //!< the number of messages discarded due to the capacity
+        int32_t held{0};  //!< the number of messages held outside the queue for later times
+    };
+    /** sorting is deferred until the messages are read so the readers may need to reorder*/
+    mutable shared_guarded<MessageStore> message_queue;  //!< storage for the messages
+    SourceNameLookup sourceNames;  //!< lookup for the names of sources given by handle
+
   public:
     bool hasFilter = false;  //!< indicator that the message has a filter
     /** get the next message up to the specified time*/
@@ -40,5 +64,32 @@ class EndpointInfo {
     Time firstMessageTime() const;
     /** clear all the message queues*/
     void clearQueue();
+    /** set the maximum number of messages held in the queue
+    @param capacity the message limit, 0 or less for no limit*/
+    void setQueueCapacity(int32_t capacity);
+    /** get the maximum number of messages held in the queue, 0 for no limit*/
+    int32_t getQueueCapacity() const;
+    /** set the action to take when a message arrives at a full queue*/
+    void setOverflowPolicy(int32_t policy);
+    /** get the action taken when a message arrives at a full queue*/
+    int32_t getOverflowPolicy() const;
+    /** get the number of messages discarded due to the queue capacity*/
+    uint64_t droppedCount() const;
+    /** get the total number of messages in the queue regardless of time*/
+    int32_t totalQueueSize() const;
+    /** count a message held until a later time against the queue capacity
+    @details the overflow policy is applied as if the held messages were in the queue,  the oldest
+    queued message is discarded here if one is needed to make room
+    @return the action to take with the message*/
+    held_message_action holdMessage();
+    /** add a message counted by holdMessage to the queue once its time is reached*/
+    void addHeldMessage(std::unique_ptr<Message> message);
+    /** get the number of messages held until a later time*/
+    int32_t heldCount() const;
+    /** set the lookup for the names of messages from endpoints of the same core
+    @details those messages carry only the handle of the source,  the names are filled in when
+    they are needed to order messages with the same time or when the message is retrieved,  this
+    should be set before any messages are added*/
+    void setSourceNameLookup(SourceNameLookup lookup);
 };
 }  // namespace helics
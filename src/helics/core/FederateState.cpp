@@ -151,6 +151,7 @@ void FederateState::reset()
     state = HELICS_CREATED;
     queue.clear();
     delayQueues.clear();
+    heldMessages.reset();
     // TODO(PT): this probably needs to do a lot more
 }
 /** reset the federate to the initializing state*/
@@ -334,6 +335,13 @@ void FederateState::createInterface(handle_type htype,
         } break;
         case handle_type::endpoint: {
             interfaceInformation.createEndpoint(handle, key, type);
+            if (parent_ != nullptr) {
+                auto* core = parent_;
+                interfaceInformation.getEndpoint(handle)->setSourceNameLookup(
+                    [core](interface_handle source) -> const std::string& {
+                        return core->getHandleName(source);
+                    });
+            }
         }
         default:
             break;
@@ -361,6 +369,13 @@ void FederateState::closeInterface(interface_handle handle, handle_type type)
             if (ept != nullptr) {
                 ept->clearQueue();
             }
+            if (heldMessages) {
+                heldMessages->removeIf(
+                    [handle](Time /*releaseTime*/,
+                             const std::pair<interface_handle, std::unique_ptr<Message>>& held) {
+                        return held.first == handle;
+                    });
+            }
         } break;
         case handle_type::input: {
             auto* ipt = interfaceInformation.getInput(handle);
@@ -460,6 +475,7 @@ iteration_result FederateState::enterExecutingMode(iteration_request iterate)
         if (ret == message_processing_result::next_step) {
             time_granted = timeZero;
             allowed_send_time = timeCoord->allowedSendTime();
+            releaseHeldMessages();
         }
         switch (iterate) {
             case iteration_request::force_iteration:
@@ -517,7 +533,8 @@ std::vector<global_handle> FederateState::getSubscribers(interface_handle handle
     std::lock_guard<FederateState> fedlock(*this);
     auto* pubInfo = interfaceInformation.getPublication(handle);
     if (pubInfo != nullptr) {
-        return pubInfo->subscribers;
+        return std::vector<global_handle>(pubInfo->subscribers.begin(),
+                                          pubInfo->subscribers.end());
     }
     return {};
 }
@@ -565,6 +582,7 @@ iteration_time FederateState::requestTime(Time nextTime, iteration_request itera
         auto ret = processQueue();
         time_granted = timeCoord->getGrantedTime();
         allowed_send_time = timeCoord->allowedSendTime();
+        releaseHeldMessages();
         iterating = (ret == message_processing_result::iterating);
 
         iteration_time retTime = {time_granted, static_cast<iteration_result>(ret)};
@@ -670,6 +688,7 @@ iteration_result FederateState::genericUnspecifiedQueueProcess()
         auto ret = processQueue();
         time_granted = timeCoord->getGrantedTime();
         allowed_send_time = timeCoord->allowedSendTime();
+        releaseHeldMessages();
         unlock();
         return static_cast<iteration_result>(ret);
     }
@@ -1063,7 +1082,20 @@ message_processing_result FederateState::processActionMessage(ActionMessage& cmd
             if (epi != nullptr) {
                 timeCoord->updateMessageTime(cmd.actionTime);
                 LOG_DATA(fmt::format("receive_message {}", prettyPrintString(cmd)));
-                epi->addMessage(createMessageFromCommand(std::move(cmd)));
+                const bool compact = checkActionFlag(cmd, compact_message_flag);
+                auto sourceHandle = cmd.source_handle;
+                auto message = createMessageFromCommand(std::move(cmd));
+                if (compact) {
+                    // the endpoint fills in the names from the handle when they are needed
+                    message->source_handle = sourceHandle;
+                }
+                if (message->time > time_granted) {
+                    // messages for later times (such as those delayed by filters) are held until
+                    // the time is granted
+                    holdMessage(*epi, std::move(message));
+                } else {
+                    epi->addMessage(std::move(message));
+                }
             }
         } break;
         case CMD_PUB: {
@@ -1627,9 +1659,64 @@ Time FederateState::nextMessageTime() const
             }
         }
     }
+    if (heldMessages && heldMessages->nextTime() < firstMessageTime) {
+        firstMessageTime = heldMessages->nextTime();
+    }
     return firstMessageTime;
 }
 
+void FederateState::holdMessage(EndpointInfo& epi, std::unique_ptr<Message> message)
+{
+    // the held messages count against the capacity of the endpoint queue
+    auto action = epi.holdMessage();
+    if (action == held_message_action::discard) {
+        return;
+    }
+    if (!heldMessages) {
+        heldMessages = std::make_unique<
+            TimingWheel<std::pair<interface_handle, std::unique_ptr<Message>>>>();
+    }
+    const auto handle = epi.id.handle;
+    if (action == held_message_action::replace_oldest) {
+        auto oldest = Time::maxVal();
+        heldMessages->forEach(
+            [handle, &oldest](Time releaseTime,
+                              const std::pair<interface_handle, std::unique_ptr<Message>>& held) {
+                if (held.first == handle && releaseTime < oldest) {
+                    oldest = releaseTime;
+                }
+            });
+        bool removed{false};
+        heldMessages->removeIf(
+            [handle, oldest, &removed](
+                Time releaseTime,
+                const std::pair<interface_handle, std::unique_ptr<Message>>& held) {
+                if (removed || held.first != handle || releaseTime != oldest) {
+                    return false;
+                }
+                removed = true;
+                return true;
+            });
+    }
+    auto releaseTime = message->time;
+    heldMessages->insert(releaseTime, std::make_pair(handle, std::move(message)));
+}
+
+void FederateState::releaseHeldMessages()
+{
+    if (!heldMessages || heldMessages->nextTime() > time_granted) {
+        return;
+    }
+    heldMessages->advance(time_granted,
+                          [this](Time /*releaseTime*/,
+                                 std::pair<interface_handle, std::unique_ptr<Message>> held) {
+                              auto* epi = interfaceInformation.getEndpoint(held.first);
+                              if (epi != nullptr) {
+                                  epi->addHeldMessage(std::move(held.second));
+                              }
+                          });
+}
+
 void FederateState::setCoreObject(CommonCore* parent)
 {
     spinlock();
@@ -1719,6 +1806,13 @@ std::string FederateState::processQueryActual(const std::string& query) const
         interfaceInformation.generateInferfaceConfig(base);
         return generateJsonString(base);
     }
+    if (query == "memory_footprint") {
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_id.load().baseValue();
+        interfaceInformation.generateMemoryFootprint(base);
+        return generateJsonString(base);
+    }
     if (query == "dependents") {
         return generateStringVector(timeCoord->getDependents(),
                                     [](auto& dep) { return std::to_string(dep.baseValue()); });
@@ -1731,6 +1825,14 @@ std::string FederateState::processQueryActual(const std::string& query) const
         interfaceInformation.GenerateDataFlowGraph(base);
         return generateJsonString(base);
     }
+    if (query == "endpoint_queues") {
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_id.load().baseValue();
+        base["granted_time"] = static_cast<double>(time_granted);
+        interfaceInformation.generateQueueOccupancy(base, time_granted);
+        return generateJsonString(base);
+    }
     if (query == "global_time") {
         Json::Value base;
         base["name"] = getIdentifier();
@@ -1769,7 +1871,7 @@ std::string FederateState::processQuery(const std::string& query) const
         qstring = processQueryActual(query);
     } else if ((query == "queries") || (query == "available_queries")) {
         qstring =
-            "publications;inputs;endpoints;interfaces;subscriptions;dependencies;timeconfig;config;dependents;current_time";
+            "publications;inputs;endpoints;interfaces;subscriptions;dependencies;timeconfig;config;dependents;current_time;memory_footprint;endpoint_queues";
     } else {  // the rest might to prevent a race condition
         if (try_lock()) {
             qstring = processQueryActual(query);
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ActionMessage.hpp"
 #include "BasicHandleInfo.hpp"
 #include "InterfaceInfo.hpp"
+#include "TimingWheel.hpp"
 #include "core-data.hpp"
 #include "core-types.hpp"
 #include "gmlc/containers/BlockingQueue.hpp"
@@ -111,6 +112,10 @@ class FederateState {
         delayQueues;  //!< queue for delaying processing of messages for a time
     std::vector<interface_handle> events;  //!< list of value events to process
     std::vector<global_federate_id> delayedFederates;  //!< list of federates to delay messages from
+    /// messages for a time later than the granted time and the endpoints they are for,  they are
+    /// held here until the time is granted so the endpoint queues only contain reachable messages
+    std::unique_ptr<TimingWheel<std::pair<interface_handle, std::unique_ptr<Message>>>>
+        heldMessages;
     Time time_granted{startupTime};  //!< the most recent granted time;
     Time allowed_send_time{startupTime};  //!< the next time a message can be sent;
     mutable std::atomic_flag processing = ATOMIC_FLAG_INIT;  //!< the federate is processing
@@ -124,6 +129,10 @@ class FederateState {
     Time nextValueTime() const;
     /** find the next Message Event*/
     Time nextMessageTime() const;
+    /** hold a message for a later time applying the queue limits of the endpoint*/
+    void holdMessage(EndpointInfo& epi, std::unique_ptr<Message> message);
+    /** move the held messages up to the granted time into the endpoint queues*/
+    void releaseHeldMessages();
 
     /** update the federate state */
     void setState(federate_state newState);
@@ -0,0 +1,595 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "FilterExpression.hpp"
+
+#include "../utilities/timeStringOps.hpp"
+#include "core-exceptions.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace helics {
+/** the maximum depth of the boolean stack used to evaluate the conditions*/
+constexpr int maxConditionDepth{64};
+
+/** check if a string matches a pattern containing '*' and '?' wildcards*/
+static bool wildcardMatch(const std::string& value, const std::string& pattern)
+{
+    std::size_t vi{0};
+    std::size_t pi{0};
+    auto starIndex = std::string::npos;
+    std::size_t matchIndex{0};
+    while (vi < value.size()) {
+        if (pi < pattern.size() && (pattern[pi] == '?' || pattern[pi] == value[vi])) {
+            ++vi;
+            ++pi;
+        } else if (pi < pattern.size() && pattern[pi] == '*') {
+            starIndex = pi++;
+            matchIndex = vi;
+        } else if (starIndex != std::string::npos) {
+            pi = starIndex + 1;
+            vi = ++matchIndex;
+        } else {
+            return false;
+        }
+    }
+    while (pi < pattern.size() && pattern[pi] == '*') {
+        ++pi;
+    }
+    return pi == pattern.size();
+}
+
+/** class converting the text of an expression into the rules and condition code*/
+class FilterExpressionCompiler {
+  public:
+    FilterExpressionCompiler(FilterExpression& target, const std::string& expression):
+        expr(target), text(expression)
+    {
+    }
+    void compile()
+    {
+        while (true) {
+            while (peek().type == token_type::separator) {
+                next();
+            }
+            if (peek().type == token_type::end) {
+                break;
+            }
+            compileRule();
+            auto tok = next();
+            if (tok.type == token_type::end) {
+                break;
+            }
+            if (tok.type != token_type::separator) {
+                fail("unexpected '" + tok.value + "' after the actions");
+            }
+        }
+    }
+
+  private:
+    using field_id = FilterExpression::field_id;
+    using opcode = FilterExpression::opcode;
+    using action_type = FilterExpression::action_type;
+
+    enum class token_type { word, text, comparison, open, close, comma, separator, end };
+    struct Token {
+        token_type type{token_type::end};
+        std::string value;
+    };
+
+    [[noreturn]] void fail(const std::string& message) const
+    {
+        throw(InvalidParameter("invalid filter expression: " + message));
+    }
+
+    static bool isWordCharacter(char c)
+    {
+        return (c != '\0') && (std::isspace(static_cast<unsigned char>(c)) == 0) &&
+            (std::strchr(";(),=<>!~\"'", c) == nullptr);
+    }
+
+    Token readToken()
+    {
+        while (position < text.size() && text[position] != '\n' &&
+               std::isspace(static_cast<unsigned char>(text[position])) != 0) {
+            ++position;
+        }
+        Token tok;
+        if (position >= text.size()) {
+            return tok;
+        }
+        const char c = text[position];
+        switch (c) {
+            case ';':
+            case '\n':
+                tok.type = token_type::separator;
+                tok.value = c;
+                ++position;
+                return tok;
+            case '(':
+                tok.type = token_type::open;
+                tok.value = c;
+                ++position;
+                return tok;
+            case ')':
+                tok.type = token_type::close;
+                tok.value = c;
+                ++position;
+                return tok;
+            case ',':
+                tok.type = token_type::comma;
+                tok.value = c;
+                ++position;
+                return tok;
+            case '"':
+            case '\'': {
+                auto close = text.find(c, position + 1);
+                if (close == std::string::npos) {
+                    fail("unterminated string");
+                }
+                tok.type = token_type::text;
+                tok.value = text.substr(position + 1, close - position - 1);
+                position = close + 1;
+                return tok;
+            }
+            case '=':
+            case '<':
+            case '>':
+            case '!':
+            case '~':
+                tok.type = token_type::comparison;
+                tok.value = c;
+                ++position;
+                if (position < text.size() && (text[position] == '=' || text[position] == '~') &&
+                    c != '~') {
+                    tok.value.push_back(text[position]);
+                    ++position;
+                }
+                return tok;
+            default:
+                break;
+        }
+        auto start = position;
+        while (position < text.size() && isWordCharacter(text[position])) {
+            ++position;
+        }
+        tok.type = token_type::word;
+        tok.value = text.substr(start, position - start);
+        return tok;
+    }
+
+    const Token& peek()
+    {
+        if (!lookahead) {
+            current = readToken();
+            lookahead = true;
+        }
+        return current;
+    }
+
+    Token next()
+    {
+        peek();
+        lookahead = false;
+        return std::move(current);
+    }
+
+    bool peekKeyword(const char* keyword)
+    {
+        const auto& tok = peek();
+        if (tok.type != token_type::word) {
+            return false;
+        }
+        std::string lower(tok.value);
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        return lower == keyword;
+    }
+
+    std::string nextValue(const char* what)
+    {
+        auto tok = next();
+        if (tok.type != token_type::word && tok.type != token_type::text) {
+            fail(std::string("expected ") + what);
+        }
+        return tok.value;
+    }
+
+    Time loadTime(const std::string& value)
+    {
+        try {
+            return gmlc::utilities::loadTimeFromString<Time>(value);
+        }
+        catch (const std::invalid_argument&) {
+            fail(value + " is not a valid time");
+        }
+    }
+
+    void compileRule()
+    {
+        FilterExpression::Rule rule;
+        rule.codeStart = expr.code.size();
+        if (peekKeyword("if")) {
+            next();
+            depth = 0;
+            maxDepth = 0;
+            compileOr(0);
+            if (maxDepth > maxConditionDepth) {
+                fail("the condition is too complex");
+            }
+            if (!peekKeyword("then")) {
+                fail("expected then after the condition");
+            }
+            next();
+        }
+        rule.codeEnd = expr.code.size();
+        rule.actions.push_back(compileAction());
+        while (peek().type == token_type::comma) {
+            next();
+            rule.actions.push_back(compileAction());
+        }
+        expr.rules.push_back(std::move(rule));
+    }
+
+    FilterExpression::Action compileAction()
+    {
+        FilterExpression::Action action;
+        auto word = nextValue("an action");
+        std::transform(word.begin(), word.end(), word.begin(), ::tolower);
+        if (word == "drop") {
+            action.type = action_type::drop;
+        } else if (word == "pass") {
+            action.type = action_type::pass;
+        } else if (word == "delay") {
+            action.type = action_type::delay;
+            action.delay = loadTime(nextValue("a delay time"));
+            if (action.delay < timeZero) {
+                fail("the delay time cannot be negative");
+            }
+        } else if (word == "reroute") {
+            action.type = action_type::reroute;
+            action.target = nextValue("an endpoint to reroute to");
+        } else if (word == "clone") {
+            action.type = action_type::clone;
+            action.target = nextValue("an endpoint to clone to");
+        } else {
+            fail("unknown action " + word);
+        }
+        return action;
+    }
+
+    void emit(opcode op, field_id field = field_id::source, std::size_t operand = 0)
+    {
+        if (operand > std::numeric_limits<std::uint16_t>::max()) {
+            fail("too many constants");
+        }
+        expr.code.push_back({op, field, static_cast<std::uint16_t>(operand)});
+        switch (op) {
+            case opcode::logical_and:
+            case opcode::logical_or:
+                --depth;
+                break;
+            case opcode::logical_not:
+                break;
+            default:
+                maxDepth = std::max(maxDepth, ++depth);
+                break;
+        }
+    }
+
+    void compileOr(int nesting)
+    {
+        compileAnd(nesting);
+        while (peekKeyword("or")) {
+            next();
+            compileAnd(nesting);
+            emit(opcode::logical_or);
+        }
+    }
+
+    void compileAnd(int nesting)
+    {
+        compileUnary(nesting);
+        while (peekKeyword("and")) {
+            next();
+            compileUnary(nesting);
+            emit(opcode::logical_and);
+        }
+    }
+
+    /** compile a negation,  a group, or a comparison
+    @param nesting the number of enclosing negations and groups,  checked before recursing so deeply
+    nested conditions can't exhaust the stack*/
+    void compileUnary(int nesting)
+    {
+        if (nesting > maxConditionDepth) {
+            fail("the condition is nested too deeply");
+        }
+        if (peekKeyword("not")) {
+            next();
+            compileUnary(nesting + 1);
+            emit(opcode::logical_not);
+        } else if (peek().type == token_type::open) {
+            next();
+            compileOr(nesting + 1);
+            if (next().type != token_type::close) {
+                fail("expected )");
+            }
+        } else {
+            compileComparison();
+        }
+    }
+
+    void compileComparison()
+    {
+        static const std::pair<const char*, field_id> fields[] = {
+            {"source", field_id::source},
+            {"src", field_id::source},
+            {"dest", field_id::dest},
+            {"destination", field_id::dest},
+            {"origsource", field_id::original_source},
+            {"origdest", field_id::original_dest},
+            {"payload", field_id::payload},
+            {"data", field_id::payload},
+            {"size", field_id::size},
+            {"time", field_id::time}};
+        auto name = nextValue("a message field");
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        auto fnd = std::find_if(std::begin(fields), std::end(fields), [&name](const auto& fld) {
+            return name == fld.first;
+        });
+        if (fnd == std::end(fields)) {
+            fail("unknown message field " + name);
+        }
+        const auto field = fnd->second;
+        auto op = next();
+        if (op.type != token_type::comparison) {
+            fail("expected a comparison after " + name);
+        }
+        auto value = nextValue("a value to compare with");
+        if (field == field_id::size || field == field_id::time) {
+            compileNumberComparison(field, op.value, value);
+        } else {
+            compileStringComparison(field, op.value, std::move(value));
+        }
+    }
+
+    void compileStringComparison(field_id field, const std::string& op, std::string value)
+    {
+        bool negate{false};
+        opcode code{opcode::string_equal};
+        if (op == "=" || op == "==") {
+            code = opcode::string_equal;
+        } else if (op == "!=") {
+            code = opcode::string_equal;
+            negate = true;
+        } else if (op == "~" || op == "!~") {
+            negate = (op == "!~");
+            auto wild = value.find_first_of("*?");
+            if (wild == std::string::npos) {
+                code = opcode::string_equal;
+            } else if (wild == value.size() - 1 && value.back() == '*') {
+                // patterns with a single trailing '*' are a simple prefix check
+                code = opcode::string_prefix;
+                value.pop_back();
+            } else {
+                code = opcode::string_match;
+            }
+        } else {
+            fail("comparison " + op + " is not valid for strings");
+        }
+        expr.strings.push_back(std::move(value));
+        emit(code, field, expr.strings.size() - 1);
+        if (negate) {
+            emit(opcode::logical_not);
+        }
+    }
+
+    void compileNumberComparison(field_id field, const std::string& op, const std::string& value)
+    {
+        double number{0.0};
+        if (field == field_id::time) {
+            number = static_cast<double>(loadTime(value));
+        } else {
+            try {
+                std::size_t used{0};
+                number = std::stod(value, &used);
+                if (used != value.size()) {
+                    fail(value + " is not a valid number");
+                }
+            }
+            catch (const std::logic_error&) {
+                fail(value + " is not a valid number");
+            }
+        }
+        bool negate{false};
+        opcode code{opcode::number_equal};
+        if (op == "=" || op == "==") {
+            code = opcode::number_equal;
+        } else if (op == "!=") {
+            code = opcode::number_equal;
+            negate = true;
+        } else if (op == "<") {
+            code = opcode::number_less;
+        } else if (op == "<=") {
+            code = opcode::number_less_equal;
+        } else if (op == ">") {
+            code = opcode::number_greater;
+        } else if (op == ">=") {
+            code = opcode::number_greater_equal;
+        } else {
+            fail("comparison " + op + " is not valid for numbers");
+        }
+        expr.numbers.push_back(number);
+        emit(code, field, expr.numbers.size() - 1);
+        if (negate) {
+            emit(opcode::logical_not);
+        }
+    }
+
+    FilterExpression& expr;
+    const std::string& text;
+    std::size_t position{0};
+    Token current;
+    bool lookahead{false};
+    int depth{0};
+    int maxDepth{0};
+};
+
+FilterExpression::FilterExpression(const std::string& expression)
+{
+    FilterExpressionCompiler(*this, expression).compile();
+}
+
+const std::string& FilterExpression::stringField(const Message& message, field_id field)
+{
+    switch (field) {
+        case field_id::source:
+        default:
+            return message.source;
+        case field_id::dest:
+            return message.dest;
+        case field_id::original_source:
+            return message.original_source;
+        case field_id::original_dest:
+            return message.original_dest;
+        case field_id::payload:
+            return message.data.to_string();
+    }
+}
+
+bool FilterExpression::test(const Rule& rule, const Message& message) const
+{
+    // the conditions are evaluated on a stack of booleans stored as bits
+    std::uint64_t stack{0};
+    for (auto ii = rule.codeStart; ii < rule.codeEnd; ++ii) {
+        const auto& inst = code[ii];
+        bool result{false};
+        switch (inst.op) {
+            case opcode::logical_and:
+            case opcode::logical_or: {
+                const bool second = (stack & 1U) != 0;
+                stack >>= 1U;
+                const bool first = (stack & 1U) != 0;
+                stack >>= 1U;
+                result = (inst.op == opcode::logical_and) ? (first && second) : (first || second);
+            } break;
+            case opcode::logical_not:
+                stack ^= 1U;
+                continue;
+            case opcode::string_equal:
+                result = stringField(message, inst.field) == strings[inst.operand];
+                break;
+            case opcode::string_prefix: {
+                const auto& value = stringField(message, inst.field);
+                const auto& prefix = strings[inst.operand];
+                result = value.compare(0, prefix.size(), prefix) == 0;
+            } break;
+            case opcode::string_match:
+                result = wildcardMatch(stringField(message, inst.field), strings[inst.operand]);
+                break;
+            default: {
+                const double value = (inst.field == field_id::size) ?
+                    static_cast<double>(message.data.size()) :
+                    static_cast<double>(message.time);
+                const double number = numbers[inst.operand];
+                switch (inst.op) {
+                    case opcode::number_equal:
+                    default:
+                        result = value == number;
+                        break;
+                    case opcode::number_less:
+                        result = value < number;
+                        break;
+                    case opcode::number_less_equal:
+                        result = value <= number;
+                        break;
+                    case opcode::number_greater:
+                        result = value > number;
+                        break;
+                    case opcode::number_greater_equal:
+                        result = value >= number;
+                        break;
+                }
+            } break;
+        }
+        stack = (stack << 1U) | (result ? 1U : 0U);
+    }
+    return (rule.codeStart == rule.codeEnd) || ((stack & 1U) != 0);
+}
+
+std::unique_ptr<Message>
+    FilterExpression::evaluate(std::unique_ptr<Message> message,
+                               std::vector<std::unique_ptr<Message>>* clones) const
+{
+    for (const auto& rule : rules) {
+        if (!test(rule, *message)) {
+            continue;
+        }
+        for (const auto& action : rule.actions) {
+            switch (action.type) {
+                case action_type::drop:
+                    return nullptr;
+                case action_type::pass:
+                    return message;
+                case action_type::delay:
+                    message->time += action.delay;
+                    break;
+                case action_type::reroute:
+                    message->original_dest = message->dest;
+                    message->dest = action.target;
+                    break;
+                case action_type::clone:
+                    if (clones != nullptr) {
+                        clones->push_back(std::make_unique<Message>(*message));
+                        clones->back()->original_dest = message->dest;
+                        clones->back()->dest = action.target;
+                    }
+                    break;
+            }
+        }
+    }
+    return message;
+}
+
+ExpressionFilterOperator::ExpressionFilterOperator(
+    std::shared_ptr<const FilterExpression> compiledExpression):
+    expression(std::move(compiledExpression))
+{
+}
+
+void ExpressionFilterOperator::setExpression(
+    std::shared_ptr<const FilterExpression> compiledExpression)
+{
+    expression.store(std::move(compiledExpression));
+}
+
+std::unique_ptr<Message> ExpressionFilterOperator::process(std::unique_ptr<Message> message)
+{
+    auto compiled = expression.load();
+    if (!compiled) {
+        return message;
+    }
+    return compiled->evaluate(std::move(message), nullptr);
+}
+
+std::vector<std::unique_ptr<Message>>
+    ExpressionFilterOperator::processVector(std::unique_ptr<Message> message)
+{
+    std::vector<std::unique_ptr<Message>> clones;
+    auto compiled = expression.load();
+    if (compiled) {
+        // in a cloning filter only the generated copies are delivered
+        (void)(compiled->evaluate(std::move(message), &clones));
+    }
+    return clones;
+}
+}  // namespace helics
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "core-data.hpp"
+#include "gmlc/libguarded/atomic_guarded.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** @file
+declarative filter expressions which are compiled once and evaluated directly in the core
+*/
+namespace helics {
+class FilterExpressionCompiler;
+
+/** a compiled set of filter rules
+@details the expression is a sequence of rules separated by ';' or new lines,  each rule is either a
+list of actions or "if <condition> then <actions>" and the rules are applied in order to each
+message.  Conditions compare the message fields source, dest, origsource, origdest, payload
+(strings) and size, time (numbers) and can be combined with and, or, not and parentheses.  String
+fields support ==, != and the wildcard matches ~ and !~ using '*' and '?',  numeric fields support
+==, !=, <, <=, >, >=.  The actions are drop, pass (stop processing the rules), delay <time>,
+reroute <endpoint>, and clone <endpoint>,  multiple actions are separated by ','.
+for example "if size > 1000 and dest ~ 'fed2*' then delay 50ms; if payload ~ 'ERR*' then drop"
+*/
+class FilterExpression {
+  public:
+    /** compile an expression
+    @throw InvalidParameter if the expression is not valid*/
+    explicit FilterExpression(const std::string& expression);
+    /** apply the rules to a message
+    @param message the message to filter
+    @param clones if not nullptr the messages generated by clone actions are added to it,
+    otherwise clone actions are ignored
+    @return the filtered message or nullptr if the message was dropped*/
+    std::unique_ptr<Message> evaluate(std::unique_ptr<Message> message,
+                                      std::vector<std::unique_ptr<Message>>* clones) const;
+    /** get the number of rules in the expression*/
+    std::size_t ruleCount() const { return rules.size(); }
+
+  private:
+    /** the message fields used in the conditions*/
+    enum class field_id : std::uint8_t {
+        source,
+        dest,
+        original_source,
+        original_dest,
+        payload,
+        size,
+        time
+    };
+    /** the instructions of the condition code*/
+    enum class opcode : std::uint8_t {
+        string_equal,
+        string_prefix,
+        string_match,
+        number_equal,
+        number_less,
+        number_less_equal,
+        number_greater,
+        number_greater_equal,
+        logical_and,
+        logical_or,
+        logical_not
+    };
+    /** a single instruction operating on a stack of boolean values*/
+    struct Instruction {
+        opcode op;
+        field_id field;
+        std::uint16_t operand;  //!< the index of the string or numerical constant
+    };
+    enum class action_type : std::uint8_t { drop, pass, delay, reroute, clone };
+    /** an action applied to a message matching the condition of a rule*/
+    struct Action {
+        action_type type{action_type::pass};
+        Time delay{timeZero};
+        std::string target;
+    };
+    /** a condition and the actions to take when it is true*/
+    struct Rule {
+        std::size_t codeStart{0};  //!< the first instruction of the condition
+        std::size_t codeEnd{0};  //!< one past the last instruction,  empty means always
+        std::vector<Action> actions;
+    };
+    /** get a string field of a message*/
+    static const std::string& stringField(const Message& message, field_id field);
+    /** evaluate the condition of a rule on a message*/
+    bool test(const Rule& rule, const Message& message) const;
+    std::vector<Instruction> code;  //!< the condition code for all the rules
+    std::vector<std::string> strings;  //!< the string constants
+    std::vector<double> numbers;  //!< the numerical constants
+    std::vector<Rule> rules;  //!< the rules in order of evaluation
+
+    friend class FilterExpressionCompiler;
+};
+
+/** filter operator evaluating a compiled filter expression
+@details clone actions are only carried out if the operator is used in a cloning filter*/
+class ExpressionFilterOperator final: public FilterOperator {
+  public:
+    /** default constructor which passes all messages*/
+    ExpressionFilterOperator() = default;
+    /** construct from a compiled expression*/
+    explicit ExpressionFilterOperator(std::shared_ptr<const FilterExpression> compiledExpression);
+    /** change the expression used by the operator*/
+    void setExpression(std::shared_ptr<const FilterExpression> compiledExpression);
+    virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override;
+    virtual std::vector<std::unique_ptr<Message>>
+        processVector(std::unique_ptr<Message> message) override;
+
+  private:
+    gmlc::libguarded::atomic_guarded<std::shared_ptr<const FilterExpression>> expression;
+};
+}  // namespace helics
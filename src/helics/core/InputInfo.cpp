@@ -6,9 +6,11 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "InputInfo.hpp"
 
+#include "VectorDelta.hpp"
 #include "units/units/units.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <set>
 #include <string>
@@ -31,7 +33,8 @@ const std::shared_ptr<const data_block>& InputInfo::getData(int index) const
 }
 
 /** return true if index1 has higher priority than index2*/
-static bool priorityCheck(int32_t index1, int32_t index2, const std::vector<int32_t>& priorities)
+static bool
+    priorityCheck(int32_t index1, int32_t index2, const metadata_vector<int32_t>& priorities)
 {
     for (auto priority = priorities.rbegin(); priority != priorities.rend(); ++priority) {
         if (*priority == index1) {
@@ -98,15 +101,31 @@ void InputInfo::addData(global_handle source_id,
     if (!found) {
         return;
     }
-    if ((data_queues[index].empty()) || (valueTime > data_queues[index].back().time)) {
-        data_queues[index].emplace_back(valueTime, iteration, std::move(data));
+    auto& data_queue = data_queues[index];
+    if ((data_queue.empty()) || (valueTime > data_queue.back().time)) {
+        if (isVectorDelta(*data) && isDeltaEncodableType(source_info[index].type)) {
+            data = applyVectorDelta(data_queue.empty() ? current_data[index] :
+                                                         data_queue.back().data,
+                                    *data);
+            if (!data) {
+                // the previous value is not available so wait for the next full value
+                return;
+            }
+        }
+        data_queue.emplace_back(valueTime, iteration, std::move(data));
     } else {
         dataRecord newRecord(valueTime, iteration, std::move(data));
-        auto m = std::upper_bound(data_queues[index].begin(),
-                                  data_queues[index].end(),
-                                  newRecord,
-                                  recordComparison);
-        data_queues[index].insert(m, std::move(newRecord));
+        auto m =
+            std::upper_bound(data_queue.begin(), data_queue.end(), newRecord, recordComparison);
+        if (isVectorDelta(*newRecord.data) && isDeltaEncodableType(source_info[index].type)) {
+            newRecord.data = applyVectorDelta(
+                (m == data_queue.begin()) ? current_data[index] : std::prev(m)->data,
+                *newRecord.data);
+            if (!newRecord.data) {
+                return;
+            }
+        }
+        data_queue.insert(m, std::move(newRecord));
     }
 }
 
@@ -259,7 +278,7 @@ bool InputInfo::updateTimeUpTo(Time newTime)
         }
 
         auto res = updateData(std::move(*last), index);
-        data_queue.erase(data_queue.begin(), currentValue);
+        data_queue.pop_front(currentValue.index());
         ++index;
         if (res) {
             updated = true;
@@ -301,7 +320,7 @@ bool InputInfo::updateTimeNextIteration(Time newTime)
         }
 
         auto res = updateData(std::move(*last), index);
-        data_queue.erase(data_queue.begin(), currentValue);
+        data_queue.pop_front(currentValue.index());
         ++index;
         if (res) {
             updated = true;
@@ -333,7 +352,7 @@ bool InputInfo::updateTimeInclusive(Time newTime)
         }
 
         auto res = updateData(std::move(*last), index);
-        data_queue.erase(data_queue.begin(), currentValue);
+        data_queue.pop_front(currentValue.index());
         ++index;
         if (res) {
             updated = true;
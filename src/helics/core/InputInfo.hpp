@@ -6,6 +6,8 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "MetadataArena.hpp"
+#include "RingBufferQueue.hpp"
 #include "basic_core_types.hpp"
 
 #include <memory>
@@ -51,13 +53,18 @@ class InputInfo {
         {
         }
     };
-    /** constructor with all the information*/
+    /** constructor with all the information
+    @param arena optional arena used to store the metadata about the sources of the input*/
     InputInfo(global_handle handle,
               const std::string& key_,
               const std::string& type_,
-              const std::string& units_):
+              const std::string& units_,
+              MetadataArena* arena = nullptr):
         id(handle),
-        key(key_), type(type_), units(units_)
+        key(key_), type(type_), units(units_), input_sources(ArenaAllocator<global_handle>(arena)),
+        deactivated(ArenaAllocator<Time>(arena)),
+        source_info(ArenaAllocator<sourceInformation>(arena)),
+        priority_sources(ArenaAllocator<int32_t>(arena))
     {
     }
 
@@ -81,12 +88,14 @@ class InputInfo {
         current_data_time;  //!< the most recent published data times
     std::vector<std::shared_ptr<const data_block>>
         current_data;  //!< the most recent published data
-    std::vector<global_handle> input_sources;  //!< the sources of the input signals
-    std::vector<Time> deactivated;  //!< indicator that the source has been deactivated
-    std::vector<sourceInformation> source_info;  //!< the name,type,units of the sources
-    std::vector<int32_t> priority_sources;  //!< the list of priority inputs;
+    metadata_vector<global_handle> input_sources;  //!< the sources of the input signals
+    metadata_vector<Time> deactivated;  //!< indicator that the source has been deactivated
+    metadata_vector<sourceInformation> source_info;  //!< the name,type,units of the sources
+    metadata_vector<int32_t> priority_sources;  //!< the list of priority inputs;
   private:
-    std::vector<std::vector<dataRecord>> data_queues;  //!< queue of the data
+    /** queue of the data for each source,  stored in a ring so advancing time does not shift the
+    remaining records*/
+    std::vector<RingBufferQueue<dataRecord>> data_queues;
 
   public:
     /** get all the current data*/
@@ -21,7 +21,8 @@ void InterfaceInfo::createPublication(interface_handle handle,
                                       const std::string& type,
                                       const std::string& units)
 {
-    publications.lock()->insert(key, handle, global_handle{global_id, handle}, key, type, units);
+    publications.lock()->insert(
+        key, handle, global_handle{global_id, handle}, key, type, units, &metadataArena);
 }
 
 void InterfaceInfo::createInput(interface_handle handle,
@@ -30,7 +31,8 @@ void InterfaceInfo::createInput(interface_handle handle,
                                 const std::string& units)
 {
     auto ciHandle = inputs.lock();
-    ciHandle->insert(key, handle, global_handle{global_id, handle}, key, type, units);
+    ciHandle->insert(
+        key, handle, global_handle{global_id, handle}, key, type, units, &metadataArena);
     ciHandle->back()->only_update_on_change = only_update_on_change;
 }
 
@@ -198,14 +200,23 @@ bool InterfaceInfo::setPublicationProperty(interface_handle id, int32_t option,
 }
 
 // NOLINTNEXTLINE
-bool InterfaceInfo::setEndpointProperty(interface_handle /*id*/,
-                                        int32_t /*option*/,
-                                        int32_t /*value*/)
+bool InterfaceInfo::setEndpointProperty(interface_handle id, int32_t option, int32_t value)
 {
-    // there will likely be some future properties
-    // auto ept = getEndpoint (id);
-    // currently no properties on endpoints
-    return false;
+    auto* ept = getEndpoint(id);
+    if (ept == nullptr) {
+        return false;
+    }
+    switch (option) {
+        case defs::options::receive_queue_capacity:
+            ept->setQueueCapacity(value);
+            break;
+        case defs::options::receive_queue_overflow_policy:
+            ept->setOverflowPolicy(value);
+            break;
+        default:
+            return false;
+    }
+    return true;
 }
 
 int32_t InterfaceInfo::getInputProperty(interface_handle id, int32_t option) const
@@ -285,11 +296,20 @@ int32_t InterfaceInfo::getPublicationProperty(interface_handle id, int32_t optio
 }
 
 // NOLINTNEXTLINE
-int32_t InterfaceInfo::getEndpointProperty(interface_handle /*id*/, int32_t /*option*/) const
+int32_t InterfaceInfo::getEndpointProperty(interface_handle id, int32_t option) const
 {
-    // auto ept = getEndpoint (id);
-    // currently no properties on endpoints
-    return 0;
+    const auto* ept = getEndpoint(id);
+    if (ept == nullptr) {
+        return 0;
+    }
+    switch (option) {
+        case defs::options::receive_queue_capacity:
+            return ept->getQueueCapacity();
+        case defs::options::receive_queue_overflow_policy:
+            return ept->getOverflowPolicy();
+        default:
+            return 0;
+    }
 }
 
 std::vector<std::pair<int, std::string>> InterfaceInfo::checkInterfacesForIssues()
@@ -503,4 +523,72 @@ void InterfaceInfo::GenerateDataFlowGraph(Json::Value& base) const
     ehandle.unlock();
 }
 
+/** get the number of heap bytes used by a string, 0 if the string is stored inline*/
+static std::size_t stringHeapBytes(const std::string& str)
+{
+    const auto* obj = reinterpret_cast<const char*>(&str);
+    if (str.data() >= obj && str.data() < obj + sizeof(std::string)) {
+        return 0;
+    }
+    return str.capacity() + 1;
+}
+
+void InterfaceInfo::generateMemoryFootprint(Json::Value& base) const
+{
+    std::size_t objectBytes{0};
+    std::size_t stringBytes{0};
+    auto ihandle = inputs.lock_shared();
+    base["inputs"] = static_cast<Json::UInt64>(ihandle->size());
+    for (const auto& ipt : ihandle) {
+        objectBytes += sizeof(InputInfo);
+        stringBytes += stringHeapBytes(ipt->key) + stringHeapBytes(ipt->type) +
+            stringHeapBytes(ipt->units);
+        for (const auto& src : ipt->source_info) {
+            stringBytes += stringHeapBytes(src.key) + stringHeapBytes(src.type) +
+                stringHeapBytes(src.units);
+        }
+    }
+    ihandle.unlock();
+    auto phandle = publications.lock_shared();
+    base["publications"] = static_cast<Json::UInt64>(phandle->size());
+    for (const auto& pub : phandle) {
+        objectBytes += sizeof(PublicationInfo);
+        stringBytes += stringHeapBytes(pub->key) + stringHeapBytes(pub->type) +
+            stringHeapBytes(pub->units);
+    }
+    phandle.unlock();
+    auto ehandle = endpoints.lock_shared();
+    base["endpoints"] = static_cast<Json::UInt64>(ehandle->size());
+    for (const auto& ept : ehandle) {
+        objectBytes += sizeof(EndpointInfo);
+        stringBytes += stringHeapBytes(ept->key) + stringHeapBytes(ept->type);
+    }
+    ehandle.unlock();
+    base["object_bytes"] = static_cast<Json::UInt64>(objectBytes);
+    base["string_bytes"] = static_cast<Json::UInt64>(stringBytes);
+    Json::Value arena;
+    arena["reserved_bytes"] = static_cast<Json::UInt64>(metadataArena.bytesReserved());
+    arena["used_bytes"] = static_cast<Json::UInt64>(metadataArena.bytesUsed());
+    arena["allocations"] = static_cast<Json::UInt64>(metadataArena.allocationCount());
+    arena["blocks"] = static_cast<Json::UInt64>(metadataArena.blockCount());
+    base["arena"] = std::move(arena);
+}
+
+void InterfaceInfo::generateQueueOccupancy(Json::Value& base, Time grantedTime) const
+{
+    base["endpoints"] = Json::arrayValue;
+    auto ehandle = endpoints.lock_shared();
+    for (const auto& ept : ehandle) {
+        Json::Value eptq;
+        eptq["name"] = ept->key;
+        // the messages held for later times are counted as part of the queue
+        eptq["queued"] = ept->totalQueueSize() + ept->heldCount();
+        eptq["held"] = ept->heldCount();
+        eptq["ready"] = ept->queueSize(grantedTime);
+        eptq["capacity"] = ept->getQueueCapacity();
+        eptq["policy"] = ept->getOverflowPolicy();
+        eptq["dropped"] = static_cast<Json::UInt64>(ept->droppedCount());
+        base["endpoints"].append(std::move(eptq));
+    }
+}
 }  // namespace helics
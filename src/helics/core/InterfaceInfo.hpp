@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/GuardedTypes.hpp"
 #include "EndpointInfo.hpp"
 #include "InputInfo.hpp"
+#include "MetadataArena.hpp"
 #include "PublicationInfo.hpp"
 #include "federate_id_extra.hpp"
 #include "gmlc/containers/DualMappedPointerVector.hpp"
@@ -80,9 +81,16 @@ class InterfaceInfo {
     void generateInferfaceConfig(Json::Value& base) const;
     /** load a dependency graph for the interfaces*/
     void GenerateDataFlowGraph(Json::Value& base) const;
+    /** generate a report of the memory used by the interface metadata*/
+    void generateMemoryFootprint(Json::Value& base) const;
+    /** generate a report of the messages waiting in the endpoint queues and the queue limits
+    @param base the json object to add the report to
+    @param grantedTime the messages up to this time are reported as ready*/
+    void generateQueueOccupancy(Json::Value& base, Time grantedTime) const;
 
   private:
     std::atomic<global_federate_id> global_id;
+    MetadataArena metadataArena;  //!< storage for the registration metadata of the interfaces
     bool only_update_on_change{
         false};  //!< flag indicating that subscriptions values should only be updated on change
     shared_guarded<
@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "MetadataArena.hpp"
+
+#include <cstdint>
+
+namespace helics {
+char* MetadataArena::addBlock(std::size_t size)
+{
+    blocks.emplace_back(new char[size]);
+    reserved += size;
+    return blocks.back().get();
+}
+
+void* MetadataArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    std::lock_guard<std::mutex> lock(arenaLock);
+    ++allocations;
+    auto align = [alignment](char* loc) {
+        auto addr = reinterpret_cast<std::uintptr_t>(loc);
+        auto offset = (alignment - (addr % alignment)) % alignment;
+        return loc + offset;
+    };
+    if (bytes > blockSize_ / 4) {
+        // large requests get a dedicated block so they don't waste the rest of a standard block
+        used += bytes;
+        return align(addBlock(bytes + alignment));
+    }
+    char* loc = (current != nullptr) ? align(current) : nullptr;
+    if (loc == nullptr || loc + bytes > end) {
+        current = addBlock(blockSize_);
+        end = current + blockSize_;
+        loc = align(current);
+    }
+    current = loc + bytes;
+    lastAllocation = loc;
+    used += bytes;
+    return loc;
+}
+
+void MetadataArena::deallocate(void* ptr, std::size_t bytes) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(arenaLock);
+    used -= bytes;
+    if (ptr == lastAllocation && static_cast<char*>(ptr) + bytes == current) {
+        current = lastAllocation;
+        lastAllocation = nullptr;
+    }
+}
+
+std::size_t MetadataArena::bytesReserved() const
+{
+    std::lock_guard<std::mutex> lock(arenaLock);
+    return reserved;
+}
+
+std::size_t MetadataArena::bytesUsed() const
+{
+    std::lock_guard<std::mutex> lock(arenaLock);
+    return used;
+}
+
+std::size_t MetadataArena::allocationCount() const
+{
+    std::lock_guard<std::mutex> lock(arenaLock);
+    return allocations;
+}
+
+std::size_t MetadataArena::blockCount() const
+{
+    std::lock_guard<std::mutex> lock(arenaLock);
+    return blocks.size();
+}
+
+}  // namespace helics
@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace helics {
+/** monotonic arena for interface metadata that lives as long as a federate
+@details memory is handed out from large blocks and is only returned when the arena is destroyed,
+except that the most recent allocation can be released again which lets vectors growing during
+registration reuse their space*/
+class MetadataArena {
+  public:
+    /** the default size of each block of memory held by the arena*/
+    static constexpr std::size_t defaultBlockSize{8192};
+    explicit MetadataArena(std::size_t blockSize = defaultBlockSize): blockSize_(blockSize) {}
+    MetadataArena(const MetadataArena&) = delete;
+    MetadataArena& operator=(const MetadataArena&) = delete;
+    /** get memory from the arena
+    @param bytes the number of bytes to allocate
+    @param alignment the required alignment of the memory*/
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    /** release memory back to the arena
+    @details the memory is only reused if it was the most recent allocation*/
+    void deallocate(void* ptr, std::size_t bytes) noexcept;
+    /** get the total number of bytes held in blocks by the arena*/
+    std::size_t bytesReserved() const;
+    /** get the number of bytes currently in use by objects in the arena*/
+    std::size_t bytesUsed() const;
+    /** get the total number of allocations made from the arena*/
+    std::size_t allocationCount() const;
+    /** get the number of blocks held by the arena*/
+    std::size_t blockCount() const;
+
+  private:
+    /** add a new block of the specified size and return a pointer to its start*/
+    char* addBlock(std::size_t size);
+
+    const std::size_t blockSize_;  //!< the size of the standard blocks
+    mutable std::mutex arenaLock;  //!< lock for allocations which can come from multiple threads
+    std::vector<std::unique_ptr<char[]>> blocks;  //!< the memory blocks
+    char* current{nullptr};  //!< the next available location in the current block
+    char* end{nullptr};  //!< the end of the current block
+    char* lastAllocation{nullptr};  //!< the location of the most recent allocation
+    std::size_t reserved{0};  //!< the total number of bytes in all blocks
+    std::size_t used{0};  //!< the number of bytes currently allocated
+    std::size_t allocations{0};  //!< the number of allocations made
+};
+
+/** standard library compatible allocator using a MetadataArena
+@details if no arena is given the allocator uses the regular heap*/
+template<class T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+
+    ArenaAllocator() = default;
+    explicit ArenaAllocator(MetadataArena* arena) noexcept: arena_(arena) {}
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept:  // NOLINT
+        arena_(other.arena())
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        if (arena_ == nullptr) {
+            return std::allocator<T>{}.allocate(count);
+        }
+        return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+        if (arena_ == nullptr) {
+            std::allocator<T>{}.deallocate(ptr, count);
+        } else {
+            arena_->deallocate(ptr, count * sizeof(T));
+        }
+    }
+    MetadataArena* arena() const noexcept { return arena_; }
+
+  private:
+    MetadataArena* arena_{nullptr};
+};
+
+template<class T, class U>
+bool operator==(const ArenaAllocator<T>& alloc1, const ArenaAllocator<U>& alloc2) noexcept
+{
+    return alloc1.arena() == alloc2.arena();
+}
+
+template<class T, class U>
+bool operator!=(const ArenaAllocator<T>& alloc1, const ArenaAllocator<U>& alloc2) noexcept
+{
+    return alloc1.arena() != alloc2.arena();
+}
+
+/** vector type used for interface metadata*/
+template<class T>
+using metadata_vector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace helics
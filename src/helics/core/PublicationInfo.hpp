@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "MetadataArena.hpp"
 #include "global_federate_id.hpp"
 
 #include <cstdint>
@@ -20,13 +21,15 @@ class PublicationInfo {
     PublicationInfo(global_handle pid,
                     const std::string& pkey,
                     const std::string& ptype,
-                    const std::string& punits):
+                    const std::string& punits,
+                    MetadataArena* arena = nullptr):
         id(pid),
-        key(pkey), type(ptype), units(punits)
+        subscribers(ArenaAllocator<global_handle>(arena)), key(pkey), type(ptype), units(punits)
     {
     }
     const global_handle id;  //!< the identifier for the containing federate
-    std::vector<global_handle> subscribers;  //!< container for all the subscribers of a publication
+    /// container for all the subscribers of a publication
+    metadata_vector<global_handle> subscribers;
     const std::string key;  //!< the key identifier for the publication
     const std::string type;  //!< the type of the publication data
     const std::string units;  //!< the units of the publication data
@@ -0,0 +1,281 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** queue of records stored in a fixed size ring with an overflow for bursts
+@details removing elements from the front only moves the head of the ring so time advancement does
+not shift the remaining elements,  elements that do not fit in the ring are placed in an overflow
+and moved into the ring as space becomes available.  The overflow is only used when the ring is
+full so the logical order is always the ring contents followed by the overflow.  Elements taken
+from the overflow only advance its start so its capacity is reused by the next burst.  The ring
+storage is allocated on the first insertion.
+@tparam X the type of the records,  must be default constructible and movable
+@tparam RingSize the number of elements in the ring,  must be a power of 2
+*/
+template<class X, std::size_t RingSize = 16>
+class RingBufferQueue {
+    static_assert(RingSize > 0 && (RingSize & (RingSize - 1)) == 0,
+                  "RingSize must be a power of 2");
+
+  public:
+    /** random access iterator over the logical sequence of the queue*/
+    template<class QueueType, class ValueType>
+    class iterator_base {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<ValueType>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        iterator_base() = default;
+        iterator_base(QueueType* queue, std::size_t index): q(queue), ind(index) {}
+        /** allow conversion of a mutable iterator to a const iterator*/
+        template<class OtherQueue, class OtherValue>
+        iterator_base(const iterator_base<OtherQueue, OtherValue>& other):
+            q(other.q), ind(other.ind)
+        {
+        }
+        reference operator*() const { return (*q)[ind]; }
+        pointer operator->() const { return &((*q)[ind]); }
+        reference operator[](difference_type offset) const
+        {
+            return (*q)[ind + static_cast<std::size_t>(offset)];
+        }
+        iterator_base& operator++()
+        {
+            ++ind;
+            return *this;
+        }
+        iterator_base operator++(int)
+        {
+            auto tmp = *this;
+            ++ind;
+            return tmp;
+        }
+        iterator_base& operator--()
+        {
+            --ind;
+            return *this;
+        }
+        iterator_base operator--(int)
+        {
+            auto tmp = *this;
+            --ind;
+            return tmp;
+        }
+        iterator_base& operator+=(difference_type offset)
+        {
+            ind += static_cast<std::size_t>(offset);
+            return *this;
+        }
+        iterator_base& operator-=(difference_type offset)
+        {
+            ind -= static_cast<std::size_t>(offset);
+            return *this;
+        }
+        iterator_base operator+(difference_type offset) const
+        {
+            return iterator_base(q, ind + static_cast<std::size_t>(offset));
+        }
+        friend iterator_base operator+(difference_type offset, const iterator_base& it)
+        {
+            return it + offset;
+        }
+        iterator_base operator-(difference_type offset) const
+        {
+            return iterator_base(q, ind - static_cast<std::size_t>(offset));
+        }
+        difference_type operator-(const iterator_base& other) const
+        {
+            return static_cast<difference_type>(ind) - static_cast<difference_type>(other.ind);
+        }
+        bool operator==(const iterator_base& other) const { return ind == other.ind; }
+        bool operator!=(const iterator_base& other) const { return ind != other.ind; }
+        bool operator<(const iterator_base& other) const { return ind < other.ind; }
+        bool operator>(const iterator_base& other) const { return ind > other.ind; }
+        bool operator<=(const iterator_base& other) const { return ind <= other.ind; }
+        bool operator>=(const iterator_base& other) const { return ind >= other.ind; }
+        /** get the position of the iterator in the queue*/
+        std::size_t index() const { return ind; }
+
+      private:
+        QueueType* q{nullptr};
+        std::size_t ind{0};
+        template<class OtherQueue, class OtherValue>
+        friend class iterator_base;
+    };
+
+    using value_type = X;
+    using size_type = std::size_t;
+    using iterator = iterator_base<RingBufferQueue, X>;
+    using const_iterator = iterator_base<const RingBufferQueue, const X>;
+
+    /** get the number of elements in the queue*/
+    size_type size() const { return ringCount + overflowSize(); }
+    /** check if the queue is empty*/
+    bool empty() const { return ringCount == 0; }
+    /** get the number of elements the ring holds before using the overflow*/
+    static constexpr size_type ringCapacity() { return RingSize; }
+    /** get the number of elements currently held in the overflow*/
+    size_type overflowSize() const { return overflow.size() - overflowStart; }
+
+    X& operator[](size_type index)
+    {
+        return (index < ringCount) ? ring[(head + index) & mask] :
+                                     overflow[overflowStart + index - ringCount];
+    }
+    const X& operator[](size_type index) const
+    {
+        return (index < ringCount) ? ring[(head + index) & mask] :
+                                     overflow[overflowStart + index - ringCount];
+    }
+    X& front() { return ring[head]; }
+    const X& front() const { return ring[head]; }
+    X& back()
+    {
+        return (overflowSize() == 0) ? ring[(head + ringCount - 1) & mask] : overflow.back();
+    }
+    const X& back() const
+    {
+        return (overflowSize() == 0) ? ring[(head + ringCount - 1) & mask] : overflow.back();
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    /** add an element to the end of the queue*/
+    void push_back(X&& val)
+    {
+        if (ringCount < RingSize) {
+            if (ring.empty()) {
+                ring.resize(RingSize);
+            }
+            ring[(head + ringCount) & mask] = std::move(val);
+            ++ringCount;
+        } else {
+            overflow.push_back(std::move(val));
+        }
+    }
+    /** construct an element at the end of the queue*/
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        push_back(X(std::forward<Args>(args)...));
+    }
+
+    /** insert an element before the given position
+    @details elements after the position in the ring are shifted back by one,  if the ring is full
+    the last element in the ring is moved to the front of the overflow*/
+    void insert(const_iterator position, X&& val)
+    {
+        auto index = position.index();
+        if (index >= size()) {
+            push_back(std::move(val));
+            return;
+        }
+        if (index >= ringCount) {
+            overflow.insert(overflow.begin() +
+                                static_cast<std::ptrdiff_t>(overflowStart + index - ringCount),
+                            std::move(val));
+            return;
+        }
+        if (ringCount == RingSize) {
+            // the last element of the ring becomes the first element of the overflow
+            auto& last = ring[(head + RingSize - 1) & mask];
+            if (overflowStart > 0) {
+                --overflowStart;
+                overflow[overflowStart] = std::move(last);
+            } else {
+                overflow.insert(overflow.begin(), std::move(last));
+            }
+        } else {
+            ++ringCount;
+        }
+        for (size_type ii = ringCount - 1; ii > index; --ii) {
+            ring[(head + ii) & mask] = std::move(ring[(head + ii - 1) & mask]);
+        }
+        ring[(head + index) & mask] = std::move(val);
+    }
+
+    /** remove count elements from the front of the queue*/
+    void pop_front(size_type count = 1)
+    {
+        if (count >= size()) {
+            clear();
+            return;
+        }
+        auto ringRemove = (count < ringCount) ? count : ringCount;
+        for (size_type ii = 0; ii < ringRemove; ++ii) {
+            // release the stored value now rather than when the slot is reused
+            ring[(head + ii) & mask] = X{};
+        }
+        head = (head + ringRemove) & mask;
+        ringCount -= ringRemove;
+        for (size_type ii = ringRemove; ii < count; ++ii) {
+            overflow[overflowStart] = X{};
+            ++overflowStart;
+        }
+        while (ringCount < RingSize && overflowStart < overflow.size()) {
+            ring[(head + ringCount) & mask] = std::move(overflow[overflowStart]);
+            ++overflowStart;
+            ++ringCount;
+        }
+        if (overflowStart == overflow.size()) {
+            overflow.clear();
+            overflowStart = 0;
+        } else if (overflowStart >= RingSize && overflowStart * 2 >= overflow.size()) {
+            // drop the consumed part once it is the majority so a steady backlog stays bounded
+            overflow.erase(overflow.begin(),
+                           overflow.begin() + static_cast<std::ptrdiff_t>(overflowStart));
+            overflowStart = 0;
+        }
+    }
+    /** remove the last element of the queue*/
+    void pop_back()
+    {
+        if (overflowSize() > 0) {
+            overflow.pop_back();
+            if (overflowStart == overflow.size()) {
+                overflow.clear();
+                overflowStart = 0;
+            }
+            return;
+        }
+        --ringCount;
+        ring[(head + ringCount) & mask] = X{};
+    }
+    /** remove all elements from the queue*/
+    void clear()
+    {
+        for (size_type ii = 0; ii < ringCount; ++ii) {
+            ring[(head + ii) & mask] = X{};
+        }
+        head = 0;
+        ringCount = 0;
+        overflow.clear();
+        overflowStart = 0;
+    }
+
+  private:
+    static constexpr size_type mask{RingSize - 1};
+    std::vector<X> ring;  //!< the ring storage
+    size_type head{0};  //!< the location of the first element in the ring
+    size_type ringCount{0};  //!< the number of elements in the ring
+    std::vector<X> overflow;  //!< elements that did not fit in the ring
+    size_type overflowStart{0};  //!< the location of the first element in the overflow
+};
+}  // namespace helics
@@ -0,0 +1,157 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "global_federate_id.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace helics {
+/** class mapping global federate and broker ids to the route used to reach them
+@details global federate and broker ids are dense integers offset from a base value so the bulk of
+the lookups are served from flat vectors indexed by the offset,  any id that does not fall in the
+dense range(like the special parent and direct core ids) is stored in an overflow map
+*/
+class RoutingTable {
+  public:
+    /** the maximum number of entries stored in each of the dense vectors*/
+    static constexpr identififier_base_type maxDenseIndex{0x0010'0000};
+    /** add a route for an id if one does not already exist
+    @return true if the route was added*/
+    bool emplace(global_federate_id fedid, route_id rid)
+    {
+        auto* slot = denseSlot(fedid, true);
+        if (slot != nullptr) {
+            if (slot->isValid()) {
+                return false;
+            }
+            *slot = rid;
+            ++count;
+            return true;
+        }
+        auto res = overflow.emplace(fedid, rid);
+        if (res.second) {
+            ++count;
+        }
+        return res.second;
+    }
+    /** add or overwrite the route for an id*/
+    void setRoute(global_federate_id fedid, route_id rid)
+    {
+        if (!emplace(fedid, rid)) {
+            auto* slot = denseSlot(fedid, false);
+            if (slot != nullptr) {
+                *slot = rid;
+            } else {
+                overflow[fedid] = rid;
+            }
+        }
+    }
+    /** get the route for a particular id
+    @param fedid the global id of the federate or broker
+    @param defRoute the route to return if no route is specified for fedid
+    */
+    route_id getRoute(global_federate_id fedid, route_id defRoute = parent_route_id) const
+    {
+        const route_id* slot = denseSlot(fedid);
+        if (slot != nullptr) {
+            return (slot->isValid()) ? *slot : defRoute;
+        }
+        if (overflow.empty()) {
+            return defRoute;
+        }
+        auto fnd = overflow.find(fedid);
+        return (fnd != overflow.end()) ? fnd->second : defRoute;
+    }
+    /** check if a specific route is stored for an id*/
+    bool hasRoute(global_federate_id fedid) const
+    {
+        const route_id* slot = denseSlot(fedid);
+        if (slot != nullptr) {
+            return slot->isValid();
+        }
+        return (overflow.find(fedid) != overflow.end());
+    }
+    /** remove the route for a particular id*/
+    void erase(global_federate_id fedid)
+    {
+        auto* slot = denseSlot(fedid, false);
+        if (slot != nullptr) {
+            if (slot->isValid()) {
+                *slot = route_id{};
+                --count;
+            }
+            return;
+        }
+        count -= overflow.erase(fedid);
+    }
+    /** get the number of ids with a specified route*/
+    std::size_t size() const { return count; }
+    /** check if the table has no routes*/
+    bool empty() const { return (count == 0); }
+    /** remove all routes*/
+    void clear()
+    {
+        federateRoutes.clear();
+        brokerRoutes.clear();
+        overflow.clear();
+        count = 0;
+    }
+
+  private:
+    /** get a pointer to the dense storage slot for an id or nullptr if it is not a dense id*/
+    const route_id* denseSlot(global_federate_id fedid) const
+    {
+        if (fedid.isBroker()) {
+            auto index = fedid.baseValue() - global_broker_id_shift;
+            return (index < static_cast<identififier_base_type>(brokerRoutes.size())) ?
+                &brokerRoutes[index] :
+                nullptr;
+        }
+        if (fedid.isFederate()) {
+            auto index = fedid.localIndex();
+            return (index < static_cast<identififier_base_type>(federateRoutes.size())) ?
+                &federateRoutes[index] :
+                nullptr;
+        }
+        return nullptr;
+    }
+    /** get a modifiable slot for an id,  optionally growing the dense storage to include it*/
+    route_id* denseSlot(global_federate_id fedid, bool grow)
+    {
+        std::vector<route_id>* store{nullptr};
+        identififier_base_type index{0};
+        if (fedid.isBroker()) {
+            store = &brokerRoutes;
+            index = fedid.baseValue() - global_broker_id_shift;
+        } else if (fedid.isFederate()) {
+            store = &federateRoutes;
+            index = fedid.localIndex();
+        } else {
+            return nullptr;
+        }
+        if (index >= maxDenseIndex) {
+            return nullptr;
+        }
+        if (index >= static_cast<identififier_base_type>(store->size())) {
+            if (!grow) {
+                return nullptr;
+            }
+            store->resize(static_cast<std::size_t>(index) + 1);
+        }
+        return &(*store)[index];
+    }
+
+    std::vector<route_id> federateRoutes;  //!< routes indexed by the federate offset
+    std::vector<route_id> brokerRoutes;  //!< routes indexed by the broker offset
+    std::unordered_map<global_federate_id, route_id>
+        overflow;  //!< routes for ids outside the dense ranges
+    std::size_t count{0};  //!< the number of valid routes stored
+};
+
+}  // namespace helics
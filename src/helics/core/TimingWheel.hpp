@@ -0,0 +1,324 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "helics-time.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** hierarchical timing wheel holding records until a time is reached
+@details the time is divided into ticks of 2^resolutionBits base time units and the ticks are
+mapped onto 4 levels of 256 slots,  each level covering 256 times the span of the level below.  A
+record is stored in the lowest level where its tick shares the higher digits with the current
+position and is moved down a level when the position enters the span of its slot.  Records beyond
+the span of the top level are kept in an overflow.  Records within a slot are not sorted,  they are
+released in tick order and records with the same tick keep the order they were inserted.  The
+earliest time in the wheel is maintained on insertion and release so it is available in constant
+time.
+@tparam X the type of the records,  must be movable
+*/
+template<class X>
+class TimingWheel {
+  public:
+    /** construct a timing wheel
+    @param resolutionBits the size of a tick as a power of 2 of the base time unit*/
+    explicit TimingWheel(int resolutionBits = 20):
+        tickShift(std::min(std::max(resolutionBits, 0), 62))
+    {
+    }
+    /** add a record to be released at a particular time*/
+    void insert(Time releaseTime, X record)
+    {
+        if (releaseTime < next) {
+            next = releaseTime;
+        }
+        place(Entry{releaseTime, std::move(record)});
+        ++count;
+    }
+    /** release all the records with a time less than or equal to a given time
+    @param releaseTime the time to release the records up to
+    @param release callable taking the time and the record for each released record in time order
+    of the ticks*/
+    template<class Callback>
+    void advance(Time releaseTime, Callback&& release)
+    {
+        if (count == 0 || releaseTime < next) {
+            return;
+        }
+        const auto target = tick(releaseTime);
+        while (count > 0) {
+            const auto index = static_cast<std::size_t>(cursor & slotMask);
+            const auto slot = nextOccupied(0, index);
+            if (slot >= slotCount) {
+                // nothing left in the current block of the lowest level so jump to the next slot
+                // in use on a higher level and move its records down
+                if (!cascadeNext(target)) {
+                    break;
+                }
+                continue;
+            }
+            const auto slotTick = (cursor & ~slotMask) + static_cast<std::int64_t>(slot);
+            if (slotTick > target) {
+                break;
+            }
+            cursor = slotTick;
+            auto& entries = wheel[0][slot];
+            if (slotTick < target) {
+                for (auto& entry : entries) {
+                    release(entry.time, std::move(entry.record));
+                }
+                count -= entries.size();
+                entries.clear();
+                clearOccupied(0, slot);
+                continue;
+            }
+            // the last tick may be partially released,  the remaining records keep their order
+            std::size_t kept{0};
+            for (auto& entry : entries) {
+                if (entry.time <= releaseTime) {
+                    release(entry.time, std::move(entry.record));
+                } else {
+                    if (&entries[kept] != &entry) {
+                        entries[kept] = std::move(entry);
+                    }
+                    ++kept;
+                }
+            }
+            count -= entries.size() - kept;
+            entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(kept), entries.end());
+            if (entries.empty()) {
+                clearOccupied(0, slot);
+            }
+            break;
+        }
+        updateNext();
+    }
+    /** get the earliest time of a record in the wheel, Time::maxVal() if it is empty*/
+    Time nextTime() const { return next; }
+    /** get the number of records in the wheel*/
+    std::size_t size() const { return count; }
+    /** check if the wheel is empty*/
+    bool empty() const { return count == 0; }
+    /** call a visitor with the time and the record for each record in the wheel in no particular
+    order*/
+    template<class Visitor>
+    void forEach(Visitor&& visit) const
+    {
+        for (const auto& level : wheel) {
+            for (const auto& slot : level) {
+                for (const auto& entry : slot) {
+                    visit(entry.time, entry.record);
+                }
+            }
+        }
+        for (const auto& entry : overflow) {
+            visit(entry.time, entry.record);
+        }
+    }
+    /** remove the records matching a predicate taking the time and the record
+    @return the number of records removed*/
+    template<class Predicate>
+    std::size_t removeIf(Predicate&& remove)
+    {
+        const auto original = count;
+        auto removeFrom = [this, &remove](std::vector<Entry>& entries) {
+            auto last =
+                std::remove_if(entries.begin(), entries.end(), [&remove](const Entry& entry) {
+                    return remove(entry.time, entry.record);
+                });
+            count -= static_cast<std::size_t>(entries.end() - last);
+            entries.erase(last, entries.end());
+        };
+        for (int level = 0; level < levelCount; ++level) {
+            for (std::size_t slot = 0; slot < slotCount; ++slot) {
+                auto& entries = wheel[level][slot];
+                if (entries.empty()) {
+                    continue;
+                }
+                removeFrom(entries);
+                if (entries.empty()) {
+                    clearOccupied(level, slot);
+                }
+            }
+        }
+        removeFrom(overflow);
+        if (count != original) {
+            updateNext();
+        }
+        return original - count;
+    }
+    /** remove all the records*/
+    void clear()
+    {
+        for (auto& level : wheel) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        for (auto& level : occupied) {
+            level.fill(0U);
+        }
+        overflow.clear();
+        count = 0;
+        next = Time::maxVal();
+    }
+
+  private:
+    static constexpr int levelBits{8};
+    static constexpr std::size_t slotCount{std::size_t{1} << levelBits};
+    static constexpr std::int64_t slotMask{static_cast<std::int64_t>(slotCount) - 1};
+    static constexpr int levelCount{4};
+    static constexpr std::size_t wordCount{slotCount / 64};
+
+    struct Entry {
+        Time time;
+        X record;
+    };
+
+    std::int64_t tick(Time time) const
+    {
+        return std::max(time.getBaseTimeCode(), std::int64_t{0}) >> tickShift;
+    }
+
+    /** store an entry relative to the current position*/
+    void place(Entry&& entry)
+    {
+        const auto entryTick = std::max(tick(entry.time), cursor);
+        for (int level = 0; level < levelCount; ++level) {
+            const int shift = levelBits * (level + 1);
+            if ((entryTick >> shift) == (cursor >> shift)) {
+                const auto slot =
+                    static_cast<std::size_t>((entryTick >> (levelBits * level)) & slotMask);
+                wheel[level][slot].push_back(std::move(entry));
+                setOccupied(level, slot);
+                return;
+            }
+        }
+        overflow.push_back(std::move(entry));
+    }
+
+    /** move the position to the next slot in use above the lowest level and spread its records
+    over the lower levels
+    @return false if there is no such slot at or before the target tick*/
+    bool cascadeNext(std::int64_t target)
+    {
+        for (int level = 1; level < levelCount; ++level) {
+            const int shift = levelBits * level;
+            const auto index = static_cast<std::size_t>((cursor >> shift) & slotMask);
+            const auto slot = nextOccupied(level, index + 1);
+            if (slot >= slotCount) {
+                continue;
+            }
+            const auto blockStart = ((cursor >> (shift + levelBits)) << (shift + levelBits)) +
+                (static_cast<std::int64_t>(slot) << shift);
+            if (blockStart > target) {
+                return false;
+            }
+            cursor = blockStart;
+            std::vector<Entry> entries;
+            entries.swap(wheel[level][slot]);
+            clearOccupied(level, slot);
+            for (auto& entry : entries) {
+                place(std::move(entry));
+            }
+            return true;
+        }
+        if (overflow.empty()) {
+            return false;
+        }
+        const int shift = levelBits * levelCount;
+        auto first = tick(overflow.front().time);
+        for (const auto& entry : overflow) {
+            first = std::min(first, tick(entry.time));
+        }
+        const auto blockStart = (first >> shift) << shift;
+        if (blockStart > target) {
+            return false;
+        }
+        cursor = std::max(cursor, blockStart);
+        std::vector<Entry> entries;
+        entries.swap(overflow);
+        for (auto& entry : entries) {
+            place(std::move(entry));
+        }
+        return true;
+    }
+
+    /** find the earliest time among the records in the first slot in use*/
+    void updateNext()
+    {
+        next = Time::maxVal();
+        if (count == 0) {
+            return;
+        }
+        for (int level = 0; level < levelCount; ++level) {
+            const auto index = static_cast<std::size_t>((cursor >> (levelBits * level)) & slotMask);
+            const auto slot = nextOccupied(level, (level == 0) ? index : index + 1);
+            if (slot < slotCount) {
+                for (const auto& entry : wheel[level][slot]) {
+                    next = std::min(next, entry.time);
+                }
+                return;
+            }
+        }
+        for (const auto& entry : overflow) {
+            next = std::min(next, entry.time);
+        }
+    }
+
+    void setOccupied(int level, std::size_t slot)
+    {
+        occupied[level][slot / 64] |= (std::uint64_t{1} << (slot % 64));
+    }
+    void clearOccupied(int level, std::size_t slot)
+    {
+        occupied[level][slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+    }
+    /** find the first slot in use at or after a slot on a level
+    @return slotCount if there is none*/
+    std::size_t nextOccupied(int level, std::size_t start) const
+    {
+        for (auto word = start / 64; word < wordCount; ++word) {
+            auto bits = occupied[level][word];
+            if (word == start / 64) {
+                bits &= ~std::uint64_t{0} << (start % 64);
+            }
+            if (bits != 0U) {
+                return word * 64 + lowestBit(bits);
+            }
+        }
+        return slotCount;
+    }
+    static std::size_t lowestBit(std::uint64_t bits)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+        std::size_t bit{0};
+        while ((bits & 1U) == 0U) {
+            bits >>= 1U;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    std::array<std::array<std::vector<Entry>, slotCount>, levelCount> wheel;
+    std::array<std::array<std::uint64_t, wordCount>, levelCount> occupied{};
+    std::vector<Entry> overflow;  //!< records beyond the span of the top level
+    std::int64_t cursor{0};  //!< the current tick,  all records are at or after it
+    std::size_t count{0};  //!< the number of records in the wheel
+    Time next{Time::maxVal()};  //!< the earliest time in the wheel
+    const int tickShift;  //!< the size of a tick as a power of 2 of the base time unit
+};
+}  // namespace helics
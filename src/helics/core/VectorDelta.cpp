@@ -0,0 +1,134 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "VectorDelta.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace helics {
+/** the flag added to the endianness marker of the vector layout to indicate a delta*/
+static constexpr std::uint8_t deltaFlag{0x10};
+/** the size of the header on a full vector,  marker and element count*/
+static constexpr std::size_t vectorHeaderSize{1 + sizeof(std::uint64_t)};
+/** the size of the header on a delta,  marker full size and change count*/
+static constexpr std::size_t deltaHeaderSize{1 + 2 * sizeof(std::uint64_t)};
+/** the number of bytes used for each changed element*/
+static constexpr std::size_t deltaEntrySize{sizeof(std::uint32_t) + sizeof(double)};
+
+static std::uint8_t nativeMarker()
+{
+    static const std::uint32_t test{1};
+    return (*reinterpret_cast<const std::uint8_t*>(&test) == 1) ? 1 : 0;
+}
+
+template<class X>
+static X loadValue(const char* data, bool swap)
+{
+    X val;
+    std::memcpy(&val, data, sizeof(X));
+    if (swap) {
+        auto* bytes = reinterpret_cast<char*>(&val);
+        std::reverse(bytes, bytes + sizeof(X));
+    }
+    return val;
+}
+
+bool isDeltaEncodableType(const std::string& type)
+{
+    return (type == "double_vector" || type == "vector" || type == "double vector");
+}
+
+bool isVectorDelta(const data_block& block)
+{
+    return (block.size() >= deltaHeaderSize) &&
+        ((static_cast<std::uint8_t>(block.data()[0]) & ~std::uint8_t{1}) == deltaFlag);
+}
+
+bool encodeVectorDelta(const double* previous,
+                       std::size_t previousSize,
+                       const double* current,
+                       std::size_t size,
+                       std::string& out)
+{
+    if (size != previousSize || size > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+    // a delta is only worthwhile if it is less than half the size of the full vector
+    const std::size_t maxChanges = (size * sizeof(double) / 2) / deltaEntrySize;
+    std::vector<std::uint32_t> changed;
+    for (std::size_t ii = 0; ii < size; ++ii) {
+        // compare the bits so NaN values and signed zeros are transmitted exactly
+        if (std::memcmp(previous + ii, current + ii, sizeof(double)) != 0) {
+            if (changed.size() >= maxChanges) {
+                return false;
+            }
+            changed.push_back(static_cast<std::uint32_t>(ii));
+        }
+    }
+    out.resize(deltaHeaderSize + changed.size() * deltaEntrySize);
+    char* loc = &out[0];
+    *loc = static_cast<char>(nativeMarker() | deltaFlag);
+    ++loc;
+    const std::uint64_t header[2] = {size, changed.size()};
+    std::memcpy(loc, header, sizeof(header));
+    loc += sizeof(header);
+    if (!changed.empty()) {
+        std::memcpy(loc, changed.data(), changed.size() * sizeof(std::uint32_t));
+        loc += changed.size() * sizeof(std::uint32_t);
+        for (auto index : changed) {
+            std::memcpy(loc, current + index, sizeof(double));
+            loc += sizeof(double);
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const data_block> applyVectorDelta(const std::shared_ptr<const data_block>& base,
+                                                   const data_block& delta)
+{
+    if (!base || !isVectorDelta(delta) || base->size() < vectorHeaderSize) {
+        return nullptr;
+    }
+    auto baseMarker = static_cast<std::uint8_t>(base->data()[0]);
+    if (baseMarker > 1) {
+        return nullptr;
+    }
+    const char* dloc = delta.data();
+    const bool deltaSwap = ((static_cast<std::uint8_t>(dloc[0]) & 1) != nativeMarker());
+    const bool baseSwap = (baseMarker != nativeMarker());
+    const auto fullSize = loadValue<std::uint64_t>(dloc + 1, deltaSwap);
+    const auto changeCount = loadValue<std::uint64_t>(dloc + 1 + sizeof(std::uint64_t), deltaSwap);
+    if (loadValue<std::uint64_t>(base->data() + 1, baseSwap) != fullSize ||
+        fullSize > base->size() / sizeof(double) ||
+        base->size() != vectorHeaderSize + fullSize * sizeof(double) ||
+        changeCount > (delta.size() - deltaHeaderSize) / deltaEntrySize ||
+        delta.size() != deltaHeaderSize + changeCount * deltaEntrySize) {
+        return nullptr;
+    }
+    std::string result = base->to_string();
+    char* elements = &result[vectorHeaderSize];
+    const char* indices = dloc + deltaHeaderSize;
+    const char* values = indices + changeCount * sizeof(std::uint32_t);
+    // values are stored in the byte order of the base so only swap if the orders differ
+    const bool swapValues = (deltaSwap != baseSwap);
+    for (std::uint64_t ii = 0; ii < changeCount; ++ii) {
+        auto index = loadValue<std::uint32_t>(indices + ii * sizeof(std::uint32_t), deltaSwap);
+        if (index >= fullSize) {
+            return nullptr;
+        }
+        char* target = elements + static_cast<std::size_t>(index) * sizeof(double);
+        std::memcpy(target, values + ii * sizeof(double), sizeof(double));
+        if (swapValues) {
+            std::reverse(target, target + sizeof(double));
+        }
+    }
+    return std::make_shared<const data_block>(std::move(result));
+}
+}  // namespace helics
@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "core-data.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/** @file
+sparse delta encoding of double vector values
+@details a delta contains the indices and new values of the elements that changed since the previous
+value from the same publication,  the receiving core rebuilds the full vector before it is queued so
+everything past the input sees regular vector data.  The layout is a marker byte (the endianness
+marker of the vector layout with the delta flag set),  the full vector size and number of changes as
+uint64,  the changed indices as uint32 and then the changed values
+*/
+
+namespace helics {
+/** check if a publication type is one for which delta encoded data is interpreted*/
+bool isDeltaEncodableType(const std::string& type);
+
+/** check if a block of data holds a vector delta*/
+bool isVectorDelta(const data_block& block);
+
+/** generate a delta between two double vectors
+@param previous the previous values known to the receivers
+@param previousSize the number of elements in previous
+@param current the new values
+@param size the number of elements in current
+@param[out] out the encoded delta
+@return false if a delta cannot be generated or would not be sufficiently smaller than the full
+vector*/
+bool encodeVectorDelta(const double* previous,
+                       std::size_t previousSize,
+                       const double* current,
+                       std::size_t size,
+                       std::string& out);
+
+/** rebuild a full vector by applying a delta to the previous value
+@param base the previous full vector value
+@param delta the delta to apply
+@return the new full value or a nullptr if the delta is invalid or does not match the base*/
+std::shared_ptr<const data_block> applyVectorDelta(const std::shared_ptr<const data_block>& base,
+                                                   const data_block& delta);
+}  // namespace helics
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "federate_id.hpp"
 #include "helics-time.hpp"
 #include "helics/helics-config.h"
 
@@ -154,6 +155,9 @@ class Message {
     std::string source;  //!< the most recent source of the message
     std::string original_source;  //!< the original source of the message
     std::string original_dest;  //!< the original destination of a message
+    /** the handle of the source endpoint if it is in the same core and the source names have not
+    been filled in yet*/
+    interface_handle source_handle;
     std::int32_t counter{0};  //!< indexing counter not used directly by helics
     void* backReference{nullptr};  //!< back referencing pointer not used by helics
 
@@ -170,6 +174,7 @@ class Message {
         dest.swap(m2.dest);
         data.swap(m2.data);
         original_dest.swap(m2.original_dest);
+        std::swap(source_handle, m2.source_handle);
     }
     /** check if the Message contains an actual Message
     @return false if there is no Message data*/
@@ -25,6 +25,8 @@ enum operation_flags : uint16_t {
     clone_flag =
         9,  //!< flag indicating the filter is a clone filter or the data needs to be cloned
     extra_flag2 = 8,  //!< extra flag
+    compact_message_flag =
+        10,  //!< flag indicating a message is addressed by handles and carries no names
     destination_processing_flag =
         11,  //!< flag indicating the message is for destination processing
     disconnected_flag = 12,  //!< flag indicating that a broker/federate is disconnected
@@ -40,6 +42,14 @@ constexpr uint16_t slow_responding_flag =
 constexpr uint16_t cancel_flag =
     extra_flag3;  // overload of extra_flag3 indicating an operation is canceled
 
+constexpr uint16_t located_destination_flag =
+    extra_flag1;  // overload of extra_flag1 indicating a message is addressed to the handle of a
+                  // named destination located by a broker
+
+constexpr uint16_t locate_destination_flag =
+    extra_flag4;  // overload of extra_flag4 indicating the sending core does not know the location
+                  // of the named destination of a message
+
 /** template function to set a flag in an object containing a flags field
 @tparam FlagContainer an object with a .flags field
 @tparam FlagIndex a type that can be used as part of a shift to index into a flag object
@@ -133,7 +133,15 @@ namespace defs {
         multi_input_handling_method = helics_handle_option_multi_input_handling_method,
         input_priority_location = helics_handle_option_input_priority_location,
         clear_priority_list = helics_handle_option_clear_priority_list,
-        connections = helics_handle_option_connections
+        connections = helics_handle_option_connections,
+        receive_queue_capacity = helics_handle_option_receive_queue_capacity,
+        receive_queue_overflow_policy = helics_handle_option_receive_queue_overflow_policy
+    };
+
+    /** actions taken when a message arrives at a full endpoint queue*/
+    enum queue_overflow : int32_t {
+        drop_oldest = helics_queue_overflow_drop_oldest,
+        drop_newest = helics_queue_overflow_drop_newest
     };
 
 }  // namespace defs
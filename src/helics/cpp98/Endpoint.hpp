@@ -232,6 +232,22 @@ class Endpoint {
     /** Get a packet from an endpoint **/
     Message getMessage() { return Message(helicsEndpointGetMessageObject(ep)); }
 
+    /** get up to maxCount packets from an endpoint*/
+    std::vector<Message> receiveBatch(int maxCount)
+    {
+        std::vector<Message> batch;
+        if (maxCount <= 0) {
+            return batch;
+        }
+        std::vector<helics_message_object> objects(maxCount);
+        int cnt = helicsEndpointReceiveBatch(ep, &objects[0], maxCount);
+        batch.reserve(cnt);
+        for (int ii = 0; ii < cnt; ++ii) {
+            batch.push_back(Message(objects[ii]));
+        }
+        return batch;
+    }
+
     /** create a message object */
     Message createMessage()
     {
@@ -280,6 +296,40 @@ class Endpoint {
         helicsEndpointSendEventRaw(
             ep, dest.c_str(), data, static_cast<int>(data_size), time, hThrowOnError());
     }
+    /** send a set of strings in a single batch
+    @param dests the destinations of the messages,  a single destination is used for all the
+    messages and an empty vector uses the default destination
+    @param data the messages to send,  a single message is sent to all the destinations
+    @param time the time to send the messages,  helics_time_zero sends them as soon as possible
+    */
+    void sendBatch(const std::vector<std::string>& dests,
+                   const std::vector<std::string>& data,
+                   helics_time time = helics_time_zero)
+    {
+        if (data.empty()) {
+            return;
+        }
+        size_t count = (dests.size() > data.size()) ? dests.size() : data.size();
+        std::vector<const char*> destPtrs(dests.size() + 1, HELICS_NULL_POINTER);
+        for (size_t ii = 0; ii < dests.size(); ++ii) {
+            destPtrs[ii] = dests[ii].c_str();
+        }
+        std::vector<const void*> dataPtrs(count);
+        std::vector<int> lengths(count);
+        for (size_t ii = 0; ii < count; ++ii) {
+            const std::string& msg = (data.size() == 1) ? data[0] : data[ii];
+            dataPtrs[ii] = msg.c_str();
+            lengths[ii] = static_cast<int>(msg.size());
+        }
+        helicsEndpointSendBatch(ep,
+                                dests.empty() ? HELICS_NULL_POINTER : &destPtrs[0],
+                                static_cast<int>(dests.size()),
+                                &dataPtrs[0],
+                                &lengths[0],
+                                static_cast<int>(count),
+                                time,
+                                hThrowOnError());
+    }
     /** send a string to the target destination
     @param data the information to send
     */
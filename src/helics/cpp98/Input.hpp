@@ -147,6 +147,13 @@ class Input {
         data.resize(actualSize);
         helicsInputGetVector(inp, data.data(), actualSize, HELICS_NULL_POINTER, hThrowOnError());
     }
+    /** get a read only pointer to the current vector value
+    @param[out] size the number of doubles in the vector
+    @return a pointer to the data which remains valid until the next call for this input*/
+    const double* getVectorView(int& size)
+    {
+        return helicsInputGetVectorView(inp, &size, hThrowOnError());
+    }
 
     /** Check if an input is updated **/
     bool isUpdated() const { return (helicsInputIsUpdated(inp) > 0); }
@@ -99,6 +99,22 @@ class MessageFederate: public virtual Federate {
     /** Get a packet for any endpoints in the federate **/
     Message getMessage() { return Message(helicsFederateGetMessageObject(fed)); }
 
+    /** get up to maxCount packets for any endpoints in the federate*/
+    std::vector<Message> receiveBatch(int maxCount)
+    {
+        std::vector<Message> batch;
+        if (maxCount <= 0) {
+            return batch;
+        }
+        std::vector<helics_message_object> objects(maxCount);
+        int cnt = helicsFederateReceiveBatch(fed, &objects[0], maxCount);
+        batch.reserve(cnt);
+        for (int ii = 0; ii < cnt; ++ii) {
+            batch.push_back(Message(objects[ii]));
+        }
+        return batch;
+    }
+
     /** create a message object */
     Message createMessage()
     {
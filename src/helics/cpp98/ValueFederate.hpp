@@ -458,6 +458,41 @@ class ValueFederate: public virtual Federate {
     {
         helicsFederatePublishJSON(fed, json.c_str(), hThrowOnError());
     }
+    /** get the values of all the inputs as doubles in a single call
+    @param[out] values the value of each input in index order
+    @param[out] updateTimes the time of the last update of each input
+    @param[out] updateMask bit (i%8) of byte (i/8) is set if input i was updated
+    @return the number of inputs read*/
+    int getInputDoubles(std::vector<double>& values,
+                        std::vector<helics_time>& updateTimes,
+                        std::vector<unsigned char>& updateMask)
+    {
+        int count = helicsFederateGetInputCount(fed);
+        values.resize(count);
+        updateTimes.resize(count);
+        updateMask.resize((count + 7) / 8);
+        if (count == 0) {
+            return 0;
+        }
+        return helicsFederateGetInputDoubles(
+            fed, &values[0], &updateTimes[0], &updateMask[0], count, hThrowOnError());
+    }
+    /** publish double values to a set of publications in a single batch
+    @param pubList the publications to publish
+    @param vals the values to publish, one for each publication, if the sizes differ only the
+    shorter length is published*/
+    void publishBatch(const std::vector<Publication>& pubList, const std::vector<double>& vals)
+    {
+        if (pubList.empty() || vals.empty()) {
+            return;
+        }
+        std::vector<helics_publication> handles(pubList.size());
+        for (size_t ii = 0; ii < pubList.size(); ++ii) {
+            handles[ii] = pubList[ii];
+        }
+        int count = static_cast<int>((vals.size() < pubList.size()) ? vals.size() : pubList.size());
+        helicsFederatePublishBatch(fed, &handles[0], &vals[0], count, hThrowOnError());
+    }
 
   private:
     // Utility function for converting numbers to string
@@ -265,9 +265,22 @@ typedef enum {
     /** specify that the priority list should be cleared or question if it is cleared*/
     helics_handle_option_clear_priority_list = 512,
     /** specify the required number of connections or get the actual number of connections*/
-    helics_handle_option_connections = 522
+    helics_handle_option_connections = 522,
+    /** specify the maximum number of messages held in an endpoint queue (0 for no limit)*/
+    helics_handle_option_receive_queue_capacity = 530,
+    /** specify the action taken when an endpoint queue is full see \ref
+       helics_queue_overflow_policy*/
+    helics_handle_option_receive_queue_overflow_policy = 532
 } helics_handle_options;
 
+/** enumeration of the actions taken when a message arrives at a full endpoint queue*/
+typedef enum {
+    /** discard the message at the front of the queue to make room for the new message*/
+    helics_queue_overflow_drop_oldest = 0,
+    /** discard the incoming message*/
+    helics_queue_overflow_drop_newest = 1
+} helics_queue_overflow_policy;
+
 /** enumeration of the predefined filter types*/
 typedef enum {
     /** a custom filter type that executes a user defined callback*/
@@ -285,7 +298,9 @@ typedef enum {
     helics_filter_type_clone = 5,
     /** a customizable filter type that can perform different actions on a message based on
        firewall like rules*/
-    helics_filter_type_firewall = 6
+    helics_filter_type_firewall = 6,
+    /** a filter type that applies a set of declarative rules evaluated within the core*/
+    helics_filter_type_expression = 7
 
 } helics_filter_type;
 
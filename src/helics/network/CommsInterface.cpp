@@ -110,6 +110,7 @@ void CommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
         interfaceNetwork = netInfo.interfaceNetwork;
         maxMessageSize = netInfo.maxMessageSize;
         maxMessageCount = netInfo.maxMessageCount;
+        messageChunkSize = std::min(netInfo.messageChunkSize, maxMessageChunkSize);
         brokerInitString = netInfo.brokerInitString;
         autoBroker = netInfo.autobroker;
         switch (netInfo.server_mode) {
@@ -157,9 +158,20 @@ void CommsInterface::propertyUnLock()
     operating.compare_exchange_strong(exp, false);
 }
 
+/** check if a message is big enough to be sent in chunks
+@details priority and protocol commands are always sent whole*/
+static bool useChunks(const ActionMessage& cmd, int chunkSize)
+{
+    return (chunkSize > 0) && (cmd.payload.size() > static_cast<std::size_t>(chunkSize)) &&
+        (cmd.payload.size() < static_cast<std::size_t>((std::numeric_limits<int32_t>::max)())) &&
+        !isPriorityCommand(cmd) && !isProtocolCommand(cmd);
+}
+
 void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 {
-    if (isPriorityCommand(cmd)) {
+    if (useChunks(cmd, messageChunkSize)) {
+        txQueue.emplaceChunked(rid, ActionMessage(cmd), messageChunkSize);
+    } else if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, cmd);
     } else {
         txQueue.emplace(rid, cmd);
@@ -168,7 +180,9 @@ void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 
 void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
 {
-    if (isPriorityCommand(cmd)) {
+    if (useChunks(cmd, messageChunkSize)) {
+        txQueue.emplaceChunked(rid, std::move(cmd), messageChunkSize);
+    } else if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, std::move(cmd));
     } else {
         txQueue.emplace(rid, std::move(cmd));
@@ -477,7 +491,13 @@ bool CommsInterface::reconnect()
 void CommsInterface::setCallback(std::function<void(ActionMessage&&)> callback)
 {
     if (propertyLock()) {
-        ActionCallback = std::move(callback);
+        // messages sent in chunks are reassembled before they are passed along
+        ActionCallback = [this, callback = std::move(callback)](ActionMessage&& cmd) {
+            if (cmd.action() == CMD_MESSAGE_CHUNK && !assembler.addChunk(cmd)) {
+                return;
+            }
+            callback(std::move(cmd));
+        };
         propertyUnLock();
     }
 }
@@ -504,6 +524,14 @@ void CommsInterface::setMessageSize(int maxMsgSize, int maxCount)
     }
 }
 
+void CommsInterface::setMessageChunkSize(int chunkSize)
+{
+    if (propertyLock()) {
+        messageChunkSize = std::min(std::max(chunkSize, 0), maxMessageChunkSize);
+        propertyUnLock();
+    }
+}
+
 void CommsInterface::setFlag(const std::string& flag, bool val)
 {
     if (flag == "server_mode") {
@@ -6,10 +6,10 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "MessageChunking.hpp"
 #include "NetworkBrokerData.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/concurrency/TripWire.hpp"
-#include "gmlc/containers/BlockingPriorityQueue.hpp"
 #include "helics/core/ActionMessage.hpp"
 
 #include <functional>
@@ -77,6 +77,10 @@ class CommsInterface {
     /** set the max message size and max Queue size
      */
     void setMessageSize(int maxMsgSize, int maxCount);
+    /** set the payload size above which messages are split into chunks for transmission
+    @param chunkSize the maximum payload size of a chunk,  0 to disable the chunking
+    */
+    void setMessageChunkSize(int chunkSize);
     /** check if the commInterface is connected
      */
     bool isConnected() const;
@@ -136,13 +140,13 @@ class CommsInterface {
         4000};  // timeout for the initial connection to a broker or to bind a broker port(in ms)
     int maxMessageSize = 16 * 1024;  //!< the maximum message size for the queues (if needed)
     int maxMessageCount = 512;  //!< the maximum number of message to buffer (if needed)
+    int messageChunkSize = 0;  //!< the payload size above which messages are sent in chunks
     std::atomic<bool> requestDisconnect{false};  //!< flag gets set when disconnect is called
     std::function<void(ActionMessage&&)>
         ActionCallback;  //!< the callback for what to do with a received message
     std::function<void(int level, const std::string& name, const std::string& message)>
         loggingCallback;  //!< callback for logging
-    gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>>
-        txQueue;  //!< set of messages waiting to be transmitted
+    TransmitQueue txQueue;  //!< set of messages waiting to be transmitted
     // closing the files or connection can take some time so there is a need for inter-thread
     // communication to not spit out warning messages if it is in the process of disconnecting
     std::atomic<bool> disconnecting{
@@ -150,6 +154,7 @@ class CommsInterface {
     interface_networks interfaceNetwork = interface_networks::local;
 
   private:
+    MessageAssembler assembler;  //!< storage for the messages received in chunks
     std::thread queue_transmitter;  //!< single thread for sending data
     std::thread queue_watcher;  //!< thread monitoring the receive queue
     std::mutex threadSyncLock;  //!< lock to handle thread operations
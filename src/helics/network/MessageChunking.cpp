@@ -0,0 +1,202 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "MessageChunking.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <string>
+
+namespace helics {
+/** the header of a chunked message has a sequenceID of 0 and the chunks count up from 1*/
+static bool isChunkHeader(const ActionMessage& cmd)
+{
+    return (cmd.action() == CMD_MESSAGE_CHUNK) && (cmd.sequenceID == 0);
+}
+
+std::vector<ActionMessage> splitMessage(ActionMessage&& cmd, int32_t transferId, int chunkSize)
+{
+    std::string payload;
+    payload.swap(cmd.payload);
+    const auto totalSize = payload.size();
+    const auto step = static_cast<std::size_t>(std::max(chunkSize, 1));
+
+    std::vector<ActionMessage> parts;
+    parts.reserve(1 + (totalSize + step - 1) / step);
+    ActionMessage header(CMD_MESSAGE_CHUNK, cmd.source_id, cmd.dest_id);
+    header.messageID = transferId;
+    header.sequenceID = 0;
+    header.setExtraData(static_cast<int32_t>(totalSize));
+    header.payload = cmd.to_string();
+    parts.push_back(std::move(header));
+
+    uint32_t index{1};
+    for (std::size_t offset = 0; offset < totalSize; offset += step) {
+        ActionMessage chunk(CMD_MESSAGE_CHUNK, cmd.source_id, cmd.dest_id);
+        chunk.messageID = transferId;
+        chunk.sequenceID = index++;
+        chunk.setExtraData(static_cast<int32_t>(offset));
+        chunk.payload.assign(payload, offset, step);
+        parts.push_back(std::move(chunk));
+    }
+    return parts;
+}
+
+TransmitQueue::TransmitQueue():
+    // the transfers from different senders are told apart by the source and the identifier so
+    // start from a random point to make collisions between senders unlikely
+    transferCounter(static_cast<int32_t>(std::random_device{}() & 0x7FFFFFFFU))
+{
+}
+
+void TransmitQueue::emplaceChunked(route_id rid, ActionMessage&& cmd, int chunkSize)
+{
+    auto transferId = transferCounter++;
+    auto parts = splitMessage(std::move(cmd), transferId, chunkSize);
+    {
+        // the chunks must be staged before the header can be popped
+        std::lock_guard<std::mutex> lock(stagingLock);
+        staged.emplace(transferId,
+                       std::vector<ActionMessage>(std::make_move_iterator(parts.begin() + 1),
+                                                  std::make_move_iterator(parts.end())));
+    }
+    emplace(rid, std::move(parts.front()));
+}
+
+void TransmitQueue::releaseChunks(int32_t transferId, std::deque<ActionMessage>& stream)
+{
+    std::lock_guard<std::mutex> lock(stagingLock);
+    auto fnd = staged.find(transferId);
+    if (fnd != staged.end()) {
+        std::move(fnd->second.begin(), fnd->second.end(), std::back_inserter(stream));
+        staged.erase(fnd);
+    }
+}
+
+bool TransmitQueue::admit(value_type& msg)
+{
+    if (isPriorityCommand(msg.second)) {
+        return true;
+    }
+    auto stream = std::find_if(streams.begin(), streams.end(), [&msg](const auto& str) {
+        return str.first == msg.first;
+    });
+    const bool header = isChunkHeader(msg.second);
+    if (stream != streams.end()) {
+        // keep the order of the messages along the route
+        auto transferId = msg.second.messageID;
+        stream->second.push_back(std::move(msg.second));
+        if (header) {
+            releaseChunks(transferId, stream->second);
+        }
+        return false;
+    }
+    if (header) {
+        std::deque<ActionMessage> chunks;
+        releaseChunks(msg.second.messageID, chunks);
+        if (!chunks.empty()) {
+            streams.emplace_back(msg.first, std::move(chunks));
+        }
+    }
+    chunkTurn = true;
+    return true;
+}
+
+TransmitQueue::value_type TransmitQueue::nextChunk()
+{
+    auto stream = std::move(streams.front());
+    streams.pop_front();
+    value_type msg(stream.first, std::move(stream.second.front()));
+    stream.second.pop_front();
+    if (!stream.second.empty()) {
+        streams.push_back(std::move(stream));
+    }
+    chunkTurn = false;
+    return msg;
+}
+
+TransmitQueue::value_type TransmitQueue::pop()
+{
+    while (true) {
+        if (chunkReady()) {
+            return nextChunk();
+        }
+        // this only blocks if there are no chunks waiting
+        auto msg = base::pop();
+        if (admit(msg)) {
+            return msg;
+        }
+    }
+}
+
+stx::optional<TransmitQueue::value_type> TransmitQueue::pop(std::chrono::milliseconds timeout)
+{
+    while (true) {
+        if (chunkReady()) {
+            return nextChunk();
+        }
+        auto msg = base::pop(timeout);
+        if (!msg || admit(*msg)) {
+            return msg;
+        }
+    }
+}
+
+stx::optional<TransmitQueue::value_type> TransmitQueue::try_pop()
+{
+    while (true) {
+        if (chunkReady()) {
+            return nextChunk();
+        }
+        auto msg = base::try_pop();
+        if (!msg || admit(*msg)) {
+            return msg;
+        }
+    }
+}
+
+bool MessageAssembler::addChunk(ActionMessage& cmd)
+{
+    const auto key = std::make_pair(cmd.source_id.baseValue(), cmd.messageID);
+    std::lock_guard<std::mutex> lock(assemblyLock);
+    if (isChunkHeader(cmd)) {
+        PartialMessage partial;
+        partial.message.from_string(cmd.payload);
+        // the full payload is allocated once and the chunks are copied into place
+        partial.message.payload.resize(static_cast<std::size_t>(cmd.getExtraData()));
+        partials[key] = std::move(partial);
+        return false;
+    }
+    auto fnd = partials.find(key);
+    if (fnd == partials.end()) {
+        return false;
+    }
+    auto& partial = fnd->second;
+    auto& payload = partial.message.payload;
+    const auto offset = static_cast<std::size_t>(cmd.getExtraData());
+    if (offset >= payload.size()) {
+        return false;
+    }
+    const auto size = std::min(cmd.payload.size(), payload.size() - offset);
+    std::memcpy(&payload[offset], cmd.payload.data(), size);
+    partial.received += size;
+    if (partial.received < payload.size()) {
+        return false;
+    }
+    cmd = std::move(partial.message);
+    partials.erase(fnd);
+    return true;
+}
+
+std::size_t MessageAssembler::pendingCount() const
+{
+    std::lock_guard<std::mutex> lock(assemblyLock);
+    return partials.size();
+}
+}  // namespace helics
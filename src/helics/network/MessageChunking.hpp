@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "gmlc/containers/BlockingPriorityQueue.hpp"
+#include "helics/core/ActionMessage.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** the largest chunk size,  it keeps the serialized chunks within the message size limit*/
+constexpr int maxMessageChunkSize{8 * 1024 * 1024};
+
+/** split a message with a large payload into a header and a set of chunks
+@details the header contains the serialized message without its payload and the chunks each
+contain a slice of the payload and its offset
+@param cmd the message to split
+@param transferId an identifier used to match the chunks with the header
+@param chunkSize the maximum payload size of each chunk
+@return the header followed by the chunks*/
+std::vector<ActionMessage> splitMessage(ActionMessage&& cmd, int32_t transferId, int chunkSize);
+
+/** queue of messages waiting for transmission which sends the chunks of large messages in between
+the other messages
+@details the messages along a single route are always sent in order so a message queued after a
+large message on the same route waits for all its chunks,  messages for other routes alternate with
+the chunks and priority commands are never held back*/
+class TransmitQueue:
+    public gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>> {
+  public:
+    using value_type = std::pair<route_id, ActionMessage>;
+    /** default constructor*/
+    TransmitQueue();
+    /** queue a message splitting it into chunks
+    @param rid the route to send the message along
+    @param cmd the message to send
+    @param chunkSize the maximum payload size of the chunks*/
+    void emplaceChunked(route_id rid, ActionMessage&& cmd, int chunkSize);
+    /** get the next message to send blocking until one is available*/
+    value_type pop();
+    /** get the next message to send waiting at most timeout for one to become available*/
+    stx::optional<value_type> pop(std::chrono::milliseconds timeout);
+    /** get the next message to send if one is available*/
+    stx::optional<value_type> try_pop();
+
+  private:
+    using base = gmlc::containers::BlockingPriorityQueue<value_type>;
+    /** check if a message from the underlying queue can be sent now
+    @details messages for a route with chunks still waiting are added to the end of that stream*/
+    bool admit(value_type& msg);
+    /** check if the next message should be a chunk*/
+    bool chunkReady() const { return !streams.empty() && (chunkTurn || base::empty()); }
+    /** get the next chunk from the streams in a round robin fashion*/
+    value_type nextChunk();
+    /** move the chunks for a transfer into a stream*/
+    void releaseChunks(int32_t transferId, std::deque<ActionMessage>& stream);
+
+    std::mutex stagingLock;  //!< lock protecting the staged chunks
+    /// chunks waiting for their header to reach the front of the queue
+    std::unordered_map<int32_t, std::vector<ActionMessage>> staged;
+    /// routes with messages waiting behind chunks,  only used by the transmitting thread
+    std::deque<std::pair<route_id, std::deque<ActionMessage>>> streams;
+    std::atomic<int32_t> transferCounter{0};  //!< counter for generating transfer identifiers
+    bool chunkTurn{false};  //!< indicator that a chunk should be sent next
+};
+
+/** class reassembling the messages split into chunks by a TransmitQueue*/
+class MessageAssembler {
+  public:
+    /** add a chunk to the message it is part of
+    @param cmd the chunk, if it completes a message it is replaced by the complete message
+    @return true if cmd now contains a complete message*/
+    bool addChunk(ActionMessage& cmd);
+    /** get the number of messages which are partially received*/
+    std::size_t pendingCount() const;
+
+  private:
+    /** storage for a partially received message*/
+    struct PartialMessage {
+        ActionMessage message;  //!< the message with the payload preallocated
+        std::size_t received{0};  //!< the number of payload bytes received
+    };
+    mutable std::mutex assemblyLock;  //!< lock protecting the partial messages
+    /// the partial messages by source and transfer identifier
+    std::map<std::pair<int32_t, int32_t>, PartialMessage> partials;
+};
+}  // namespace helics
@@ -86,8 +86,28 @@ std::shared_ptr<helicsCLI11App>
                      "The maximum number of message to have in a queue")
         ->capture_default_str()
         ->check(CLI::PositiveNumber);
+    nbparser
+        ->add_option("--chunksize",
+                     messageChunkSize,
+                     "The payload size above which messages are split into chunks for transmission "
+                     "(0 to disable)")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
     nbparser->add_option("--networkretries", maxRetries, "the maximum number of network retries")
         ->capture_default_str();
+    nbparser
+        ->add_option(
+            "--connection_batch",
+            connectionBatchSize,
+            "the maximum number of new connections a broker will process in each admission window "
+            "before asking connecting cores to delay (0 for no limit)")
+        ->capture_default_str();
+    nbparser
+        ->add_option("--connection_batch_window",
+                     connectionBatchWindow,
+                     "the length of a connection admission window in ms")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
     nbparser->add_flag("--osport,--use_os_port",
                        use_os_port,
                        "specify that the ports should be allocated by the host operating system");
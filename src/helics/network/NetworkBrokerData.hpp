@@ -52,7 +52,10 @@ class NetworkBrokerData {
     int portStart{-1};  //!< the starting port for automatic port definitions
     int maxMessageSize{16 * 256};  //!< maximum message size
     int maxMessageCount{256};  //!< maximum message count
+    int messageChunkSize{1024 * 1024};  //!< the payload size above which messages are chunked
     int maxRetries{5};  //!< the maximum number of retries to establish a network connection
+    int connectionBatchSize{0};  //!< the number of connections admitted per window (0 for no limit)
+    int connectionBatchWindow{100};  //!< the length of the connection admission window in ms
     interface_networks interfaceNetwork{interface_networks::local};
     bool reuse_address{false};  //!< allow reuse of binding address
     bool use_os_port{false};  //!< specify that any automatic port allocation should use operating
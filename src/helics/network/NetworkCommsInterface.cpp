@@ -10,6 +10,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "NetworkBrokerData.hpp"
 #include "helics/core/ActionMessage.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -28,6 +30,37 @@ int NetworkCommsInterface::PortAllocator::findOpenPort(int count, const std::str
     if ((host == "127.0.0.1") || (host == "::1")) {
         return findOpenPort(count, localHostString);
     }
+    auto blk = reservedPorts.find(host);
+    if (blk != reservedPorts.end() && blk->second.first + count <= blk->second.second) {
+        auto port = blk->second.first;
+        blk->second.first += count;
+        return port;
+    }
+    return allocatePorts(count, host);
+}
+
+void NetworkCommsInterface::PortAllocator::reservePorts(int count, const std::string& host)
+{
+    if ((host == "127.0.0.1") || (host == "::1")) {
+        reservePorts(count, localHostString);
+        return;
+    }
+    auto start = allocatePorts(count, host);
+    reservedPorts[host] = std::make_pair(start, start + count);
+}
+
+bool NetworkCommsInterface::PortAllocator::hasReservedPorts(int count,
+                                                            const std::string& host) const
+{
+    if ((host == "127.0.0.1") || (host == "::1")) {
+        return hasReservedPorts(count, localHostString);
+    }
+    auto blk = reservedPorts.find(host);
+    return (blk != reservedPorts.end() && blk->second.first + count <= blk->second.second);
+}
+
+int NetworkCommsInterface::PortAllocator::allocatePorts(int count, const std::string& host)
+{
     auto np = nextPorts.find(host);
     int nextPort = startingPort;
     if (np == nextPorts.end()) {
@@ -83,6 +116,8 @@ void NetworkCommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
     brokerPort = netInfo.brokerPort;
     PortNumber = netInfo.portNumber;
     maxRetries = netInfo.maxRetries;
+    connectionBatchSize = netInfo.connectionBatchSize;
+    connectionBatchWindow = std::chrono::milliseconds(netInfo.connectionBatchWindow);
     switch (networkType) {
         case interface_type::tcp:
         case interface_type::udp:
@@ -140,9 +175,49 @@ int NetworkCommsInterface::findOpenPort(int count, const std::string& host)
                                             PortNumber + 5 * count;
         openPorts.setStartingPortNumber(start);
     }
+    if (connectionBatchSize > 0 && !openPorts.hasReservedPorts(count, host)) {
+        // pre-allocate the ports for a full batch of connections
+        openPorts.reservePorts(connectionBatchSize * count, host);
+    }
     return openPorts.findOpenPort(count, host);
 }
 
+int NetworkCommsInterface::admitConnection()
+{
+    if (connectionBatchSize <= 0) {
+        return 0;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - admissionWindowStart >= connectionBatchWindow) {
+        admissionWindowStart = now;
+        admittedConnections = 0;
+        deferredConnections = 0;
+    }
+    if (admittedConnections < connectionBatchSize) {
+        ++admittedConnections;
+        return 0;
+    }
+    // spread the deferred connections over the following windows
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        connectionBatchWindow - (now - admissionWindowStart));
+    auto delay = remaining.count() +
+        static_cast<long long>(deferredConnections / connectionBatchSize) *
+            connectionBatchWindow.count();
+    ++deferredConnections;
+    return std::max(static_cast<int>(delay), 1);
+}
+
+std::chrono::milliseconds
+    NetworkCommsInterface::getConnectionRetryDelay(const ActionMessage& delayCmd) const
+{
+    auto delay = delayCmd.getExtraData();
+    if (delay <= 0) {
+        return std::chrono::seconds(2);
+    }
+    auto spread = std::hash<std::string>{}(name) % (static_cast<std::size_t>(delay) / 4 + 1);
+    return std::chrono::milliseconds(delay + static_cast<int>(spread));
+}
+
 void NetworkCommsInterface::setPortNumber(int localPortNumber)
 {
     if (propertyLock()) {
@@ -190,6 +265,13 @@ ActionMessage NetworkCommsInterface::generateReplyToIncomingMessage(ActionMessag
                 return portReply;
             } break;
             case REQUEST_PORTS: {
+                auto delay = admitConnection();
+                if (delay > 0) {
+                    ActionMessage delayReply(CMD_PROTOCOL);
+                    delayReply.messageID = DELAY_CONNECTION;
+                    delayReply.setExtraData(delay);
+                    return delayReply;
+                }
                 int cnt = (cmd.counter == 0) ? 2 : cmd.counter;
                 auto openPort = (cmd.name.empty()) ? findOpenPort(cnt, localHostString) :
                                                      findOpenPort(cnt, cmd.name);
@@ -201,6 +283,13 @@ ActionMessage NetworkCommsInterface::generateReplyToIncomingMessage(ActionMessag
                 return portReply;
             } break;
             case CONNECTION_REQUEST: {
+                auto delay = admitConnection();
+                if (delay > 0) {
+                    ActionMessage delayReply(CMD_PROTOCOL);
+                    delayReply.messageID = DELAY_CONNECTION;
+                    delayReply.setExtraData(delay);
+                    return delayReply;
+                }
                 ActionMessage connAck(CMD_PROTOCOL);
                 connAck.messageID = CONNECTION_ACK;
                 return connAck;
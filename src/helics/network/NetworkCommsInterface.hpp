@@ -9,9 +9,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "CommsInterface.hpp"
 #include "helics/helics-config.h"
 
+#include <chrono>
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 
 namespace helics {
 /** implementation for the communication interface that uses ZMQ messages to communicate*/
@@ -25,12 +27,20 @@ class NetworkCommsInterface: public CommsInterface {
         int getDefaultStartingPort() const { return startingPort; }
         void addUsedPort(int port);
         void addUsedPort(const std::string& host, int port);
+        /** reserve a contiguous block of ports on a host for upcoming requests*/
+        void reservePorts(int count, const std::string& host = "localhost");
+        /** check if there are enough reserved ports available on a host*/
+        bool hasReservedPorts(int count, const std::string& host = "localhost") const;
 
       private:
         int startingPort = -1;
         std::map<std::string, std::set<int>> usedPort;
         std::map<std::string, int> nextPorts;
+        /// blocks of pre-allocated ports [next,end) for each host
+        std::map<std::string, std::pair<int, int>> reservedPorts;
         bool isPortUsed(const std::string& host, int port) const;
+        /** allocate a new set of ports directly from the available port numbers*/
+        int allocatePorts(int count, const std::string& host);
     };
 
   public:
@@ -63,9 +73,17 @@ class NetworkCommsInterface: public CommsInterface {
     interface_networks network{interface_networks::ipv4};
     std::atomic<bool> hasBroker{false};
     int maxRetries{5};  // the maximum number of network retries
+    int connectionBatchSize{0};  //!< the number of connections admitted per window (0 for no limit)
+    std::chrono::milliseconds connectionBatchWindow{100};  //!< the connection admission window
 
   private:
     PortAllocator openPorts;  //!< a structure to deal with port allocations
+    std::chrono::steady_clock::time_point admissionWindowStart;  //!< start of the current window
+    int admittedConnections{0};  //!< the number of connections admitted in the current window
+    int deferredConnections{0};  //!< the number of connections delayed in the current window
+    /** check if a new connection handshake can be processed in the current admission window
+    @return 0 if the connection is admitted, otherwise the suggested delay in milliseconds*/
+    int admitConnection();
 
   public:
     /** find an open port for a subBroker*/
@@ -84,6 +102,10 @@ class NetworkCommsInterface: public CommsInterface {
   protected:
     ActionMessage generatePortRequest(int cnt = 1) const;
     void loadPortDefinitions(const ActionMessage& cmd);
+    /** get the time to wait before retrying a connection after a DELAY_CONNECTION message
+    @details the delay suggested by the broker is used if present along with a small offset
+    derived from the name to spread out retries from many connecting cores*/
+    std::chrono::milliseconds getConnectionRetryDelay(const ActionMessage& delayCmd) const;
 };
 
 }  // namespace helics
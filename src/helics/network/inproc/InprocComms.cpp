@@ -37,6 +37,8 @@ namespace inproc {
         if (localTargetAddress.empty()) {
             localTargetAddress = name;
         }
+        // the messages are passed directly to the receiving broker so they are never chunked
+        messageChunkSize = 0;
 
         // if (PortNumber > 0)
         //{
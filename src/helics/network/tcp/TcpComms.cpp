@@ -305,7 +305,7 @@ namespace tcp {
                             continue;
                         }
                         if (mess->second.messageID == DELAY_CONNECTION) {
-                            std::this_thread::sleep_for(std::chrono::seconds(2));
+                            std::this_thread::sleep_for(getConnectionRetryDelay(mess->second));
                             continue;
                         }
                         rxMessageQueue.push(mess->second);
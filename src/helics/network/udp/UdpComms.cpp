@@ -273,7 +273,7 @@ namespace udp {
                             broker_endpoint = *resolver.resolve(query);
                             continue;
                         } else if (m.messageID == DELAY_CONNECTION) {
-                            std::this_thread::sleep_for(std::chrono::seconds(2));
+                            std::this_thread::sleep_for(getConnectionRetryDelay(m));
                         } else if (m.messageID == DISCONNECT) {
                             if (PortNumber <= 0) {
                                 PortNumber = -1;
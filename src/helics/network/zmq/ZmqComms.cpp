@@ -366,7 +366,9 @@ namespace zeromq {
                                     return (-1);
                                 }
                             } else if (rxcmd.messageID == DELAY_CONNECTION) {
-                                std::this_thread::sleep_for(std::chrono::seconds(2));
+                                // a delay request from the broker does not count as a retry
+                                std::this_thread::sleep_for(getConnectionRetryDelay(rxcmd));
+                                continue;
                             }
                         }
                     }
@@ -173,6 +173,35 @@ HELICS_EXPORT void helicsEndpointSendEventRaw(helics_endpoint endpoint,
                                               helics_time time,
                                               helics_error* err);
 
+/**
+ * Send a batch of messages from an endpoint in a single call.
+ *
+ * @details The messages are handed to the core together which is much faster than sending each message separately when there are
+ *          many small messages.
+ *
+ * @param endpoint The endpoint to send the data from.
+ * @param destinations An array of destinations, either a single destination for all the messages or one for each message.
+ * @forcpponly
+ *             nullptr to use the default destination.
+ * @endforcpponly
+ * @param destinationCount The number of destinations in the array, must be 1 or count unless destinations is null.
+ * @param data An array of pointers to the data of each message, a null pointer sends an empty message.
+ * @param dataLengths An array of the lengths of the data of each message.
+ * @param count The number of messages to send.
+ * @param time The time the messages should be sent, a time before the current time sends the messages as soon as possible.
+ * @forcpponly
+ * @param[in,out] err A pointer to an error object for catching errors.
+ * @endforcpponly
+ */
+HELICS_EXPORT void helicsEndpointSendBatch(helics_endpoint endpoint,
+                                           const char* const* destinations,
+                                           int destinationCount,
+                                           const void* const* data,
+                                           const int* dataLengths,
+                                           int count,
+                                           helics_time time,
+                                           helics_error* err);
+
 /**
  * Send a message object from a specific endpoint.
  * @deprecated Use helicsEndpointSendMessageObject instead.
@@ -272,6 +301,19 @@ HELICS_DEPRECATED_EXPORT helics_message helicsEndpointGetMessage(helics_endpoint
  */
 HELICS_EXPORT helics_message_object helicsEndpointGetMessageObject(helics_endpoint endpoint);
 
+/**
+ * Receive several messages from a particular endpoint.
+ *
+ * @details The messages are removed from the endpoint with a single lock of the message queue.
+ *
+ * @param[in] endpoint The identifier for the endpoint.
+ * @param[out] messages An array to store the message objects in, it must have space for maxCount messages.
+ * @param maxCount The maximum number of messages to receive.
+ *
+ * @return The number of messages stored in the array.
+ */
+HELICS_EXPORT int helicsEndpointReceiveBatch(helics_endpoint endpoint, helics_message_object* messages, int maxCount);
+
 /**
  * Create a new empty message object.
  *
@@ -311,6 +353,19 @@ HELICS_DEPRECATED_EXPORT helics_message helicsFederateGetMessage(helics_federate
  */
 HELICS_EXPORT helics_message_object helicsFederateGetMessageObject(helics_federate fed);
 
+/**
+ * Receive several messages for any endpoint in the federate.
+ *
+ * @details The messages are returned in the same order as repeated calls to helicsFederateGetMessageObject.
+ *
+ * @param fed The federate to receive the messages for.
+ * @param[out] messages An array to store the message objects in, it must have space for maxCount messages.
+ * @param maxCount The maximum number of messages to receive.
+ *
+ * @return The number of messages stored in the array.
+ */
+HELICS_EXPORT int helicsFederateReceiveBatch(helics_federate fed, helics_message_object* messages, int maxCount);
+
 /**
  * Create a new empty message object.
  *
@@ -328,7 +383,8 @@ HELICS_EXPORT helics_message_object helicsFederateCreateMessageObject(helics_fed
 /**
  * Clear all stored messages from a federate.
  *
- * @details This clears messages retrieved through helicsFederateGetMessage or helicsFederateGetMessageObject
+ * @details This clears messages retrieved through helicsFederateGetMessage or helicsFederateGetMessageObject.
+ *          The message objects are returned to the pool of the federate for reuse by new messages.
  *
  * @param fed The federate to clear the message for.
  */
@@ -711,7 +767,9 @@ HELICS_EXPORT helics_message_object helicsMessageClone(helics_message_object mes
  * Free a message object from memory
  * @details memory for message is managed so not using this function does not create memory leaks, this is an indication
  * to the system that the memory for this message is done being used and can be reused for a new message.
- * helicsFederateClearMessages() can also be used to clear up all stored messages at once
+ * helicsFederateClearMessages() can also be used to clear up all stored messages at once.
+ * The freed message is kept in a pool and reused along with its buffers by the next created, cloned, or sent message object
+ * so freeing messages promptly reduces the allocations for message heavy federates.
  */
 HELICS_EXPORT void helicsMessageFree(helics_message_object message);
 
@@ -235,8 +235,67 @@ void helicsEndpointSendEventRaw(helics_endpoint endpoint,
     }
 }
 
+void helicsEndpointSendBatch(helics_endpoint endpoint,
+                             const char* const* destinations,
+                             int destinationCount,
+                             const void* const* data,
+                             const int* dataLengths,
+                             int count,
+                             helics_time time,
+                             helics_error* err)
+{
+    auto* endObj = verifyEndpoint(endpoint, err);
+    if (endObj == nullptr) {
+        return;
+    }
+    if (count <= 0) {
+        return;
+    }
+    if (data == nullptr || dataLengths == nullptr) {
+        assignError(err, helics_error_invalid_argument, "data and length arrays must not be null");
+        return;
+    }
+    std::vector<std::string> dests;
+    if (destinations == nullptr || destinationCount <= 0) {
+        dests.push_back(endObj->endPtr->getDefaultDestination());
+    } else {
+        dests.reserve(destinationCount);
+        for (int ii = 0; ii < destinationCount; ++ii) {
+            dests.emplace_back((destinations[ii] == nullptr) ? endObj->endPtr->getDefaultDestination() : destinations[ii]);
+        }
+    }
+    std::vector<helics::data_view> messages;
+    messages.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        if (data[ii] == nullptr || dataLengths[ii] <= 0) {
+            messages.emplace_back();
+        } else {
+            messages.emplace_back(reinterpret_cast<const char*>(data[ii]), static_cast<size_t>(dataLengths[ii]));
+        }
+    }
+    try {
+        endObj->fedptr->sendBatch(*endObj->endPtr, dests, messages, time);
+    }
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+}
+
 static constexpr char emptyMessageErrorString[] = "the message is NULL";
 
+/** copy the message fields without the fields used by the message holder*/
+static void copyMessageContents(const helics::Message& src, helics::Message& dest)
+{
+    dest.data = src.data;
+    dest.dest = src.dest;
+    dest.original_source = src.original_source;
+    dest.source = src.source;
+    dest.original_dest = src.original_dest;
+    dest.time = src.time;
+    dest.messageID = src.messageID;
+    dest.flags = src.flags;
+}
+
 void helicsEndpointSendMessage(helics_endpoint endpoint, helics_message* message, helics_error* err)
 {
     auto* endObj = verifyEndpoint(endpoint, err);
@@ -284,7 +343,10 @@ void helicsEndpointSendMessageObject(helics_endpoint endpoint, helics_message_ob
         return;
     }
     try {
-        endObj->endPtr->send(*mess);
+        // the copy sent to the core reuses a pooled message
+        auto copy = endObj->fed->messages.getPooledMessage();
+        copyMessageContents(*mess, *copy);
+        endObj->endPtr->send(std::move(copy));
     }
     catch (...) {
         helicsErrorHandler(err);
@@ -398,12 +460,12 @@ Message* MessageHolder::newMessage()
     if (!freeMessageSlots.empty()) {
         auto index = freeMessageSlots.back();
         freeMessageSlots.pop_back();
-        messages[index] = std::make_unique<Message>();
+        messages[index] = getPooledMessage();
         m = messages[index].get();
         m->counter = index;
 
     } else {
-        messages.push_back(std::make_unique<Message>());
+        messages.push_back(getPooledMessage());
         m = messages.back().get();
         m->counter = static_cast<int32_t>(messages.size()) - 1;
     }
@@ -430,8 +492,7 @@ void MessageHolder::freeMessage(int index)
 {
     if (isValidIndex(index, messages)) {
         if (messages[index]) {
-            messages[index]->messageValidation = 0;
-            messages[index].reset();
+            recycle(std::move(messages[index]));
             freeMessageSlots.push_back(index);
         }
     }
@@ -439,10 +500,50 @@ void MessageHolder::freeMessage(int index)
 
 void MessageHolder::clear()
 {
+    for (auto& mess : messages) {
+        if (mess) {
+            recycle(std::move(mess));
+        }
+    }
     freeMessageSlots.clear();
     messages.clear();
 }
 
+std::unique_ptr<Message> MessageHolder::getPooledMessage()
+{
+    if (messagePool.empty()) {
+        return std::make_unique<Message>();
+    }
+    auto mess = std::move(messagePool.back());
+    messagePool.pop_back();
+    return mess;
+}
+
+void MessageHolder::recycle(std::unique_ptr<Message> mess)
+{
+    // the validation code is cleared even if the message is not kept so stale handles are rejected
+    mess->messageValidation = 0;
+    if (messagePool.size() >= maxPoolSize) {
+        return;
+    }
+    mess->time = timeZero;
+    mess->flags = 0;
+    mess->messageID = 0;
+    mess->counter = 0;
+    mess->backReference = nullptr;
+    if (mess->data.to_string().capacity() > maxPooledCapacity) {
+        // don't hold on to large buffers
+        data_block().swap(mess->data);
+    } else {
+        mess->data.resize(0);
+    }
+    mess->dest.clear();
+    mess->source.clear();
+    mess->original_source.clear();
+    mess->original_dest.clear();
+    messagePool.push_back(std::move(mess));
+}
+
 }  // namespace helics
 
 // LCOV_EXCL_START
@@ -545,6 +646,40 @@ helics_message_object helicsFederateGetMessageObject(helics_federate fed)
     return fedObj->messages.addMessage(message);
 }
 
+/** store the messages in the holder and copy the references into the output array*/
+static int storeMessages(helics::MessageHolder& holder,
+                         std::vector<std::unique_ptr<helics::Message>>& batch,
+                         helics_message_object* messages)
+{
+    int cnt{0};
+    for (auto& message : batch) {
+        message->messageValidation = messageKeyCode;
+        messages[cnt++] = holder.addMessage(message);
+    }
+    return cnt;
+}
+
+int helicsEndpointReceiveBatch(helics_endpoint endpoint, helics_message_object* messages, int maxCount)
+{
+    auto* endObj = verifyEndpoint(endpoint, nullptr);
+    if (endObj == nullptr || messages == nullptr || maxCount <= 0) {
+        return 0;
+    }
+    auto batch = endObj->endPtr->receiveBatch(maxCount);
+    return storeMessages(endObj->fed->messages, batch, messages);
+}
+
+int helicsFederateReceiveBatch(helics_federate fed, helics_message_object* messages, int maxCount)
+{
+    auto* mFed = getMessageFed(fed, nullptr);
+    if (mFed == nullptr || messages == nullptr || maxCount <= 0) {
+        return 0;
+    }
+    auto* fedObj = helics::getFedObject(fed, nullptr);
+    auto batch = mFed->receiveBatch(maxCount);
+    return storeMessages(fedObj->messages, batch, messages);
+}
+
 helics_message_object helicsFederateCreateMessageObject(helics_federate fed, helics_error* err)
 {
     auto* fedObj = helics::getFedObject(fed, err);
@@ -1000,14 +1135,7 @@ void helicsMessageCopy(helics_message_object source_message, helics_message_obje
     if (mess_dest == nullptr) {
         return;
     }
-    mess_dest->data = mess_src->data;
-    mess_dest->dest = mess_src->dest;
-    mess_dest->original_source = mess_src->original_source;
-    mess_dest->source = mess_src->source;
-    mess_dest->original_dest = mess_src->original_dest;
-    mess_dest->time = mess_src->time;
-    mess_dest->messageID = mess_src->messageID;
-    mess_dest->flags = mess_src->flags;
+    copyMessageContents(*mess_src, *mess_dest);
 }
 
 helics_message_object helicsMessageClone(helics_message_object message, helics_error* err)
@@ -1022,15 +1150,7 @@ helics_message_object helicsMessageClone(helics_message_object message, helics_e
         return nullptr;
     }
     auto* mess_clone = messages->newMessage();
-
-    mess_clone->data = mess->data;
-    mess_clone->dest = mess->dest;
-    mess_clone->original_source = mess->original_source;
-    mess_clone->source = mess->source;
-    mess_clone->original_dest = mess->original_dest;
-    mess_clone->time = mess->time;
-    mess_clone->messageID = mess->messageID;
-    mess_clone->flags = mess->flags;
+    copyMessageContents(*mess, *mess_clone);
     return mess_clone;
 }
 
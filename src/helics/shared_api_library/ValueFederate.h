@@ -275,6 +275,30 @@ HELICS_EXPORT helics_input helicsFederateGetSubscription(helics_federate fed, co
  */
 HELICS_EXPORT void helicsFederateClearUpdates(helics_federate fed);
 
+/**
+ * Get the values of all the inputs of a federate as doubles in a single call.
+ *
+ * @details The arrays are filled in input index order, the same order used by helicsFederateGetInputByIndex. Each input is read as if
+ *          helicsInputGetDouble were called on it so the update flags are cleared.
+ *
+ * @param fed The value federate object to read the inputs from.
+ * @param[out] values An array of at least maxCount doubles to store the values in.
+ * @param[out] updateTimes An array of at least maxCount times to store the time of the last update of each input, may be NULL.
+ * @param[out] updateMask A bitmap of at least (maxCount+7)/8 bytes, bit (i%8) of byte (i/8) is set if input i was updated, may be NULL.
+ * @param maxCount The size of the arrays.
+ * @forcpponly
+ * @param[in,out] err The error object to complete if there is an error.
+ * @endforcpponly
+ *
+ * @return The number of inputs written, the smaller of maxCount and the number of inputs.
+ */
+HELICS_EXPORT int helicsFederateGetInputDoubles(helics_federate fed,
+                                                double values[],
+                                                helics_time updateTimes[],
+                                                unsigned char updateMask[],
+                                                int maxCount,
+                                                helics_error* err);
+
 /**
  * Register the publications via JSON publication string.
  *
@@ -299,6 +323,23 @@ HELICS_EXPORT void helicsFederateRegisterFromPublicationJSON(helics_federate fed
  */
 HELICS_EXPORT void helicsFederatePublishJSON(helics_federate fed, const char* json, helics_error* err);
 
+/**
+ * Publish double values to a set of publications in a single batch.
+ *
+ * @details Change detection is applied to each publication individually. The values are handed to the core in a single call
+ *          which is much faster than publishing each value separately when there are many publications.
+ *
+ * @param fed The value federate object through which to publish the data.
+ * @param pubs An array of publications to publish.
+ * @param values An array of values, one for each publication.
+ * @param count The number of publications in the array.
+ * @forcpponly
+ * @param[in,out] err The error object to complete if there is an error.
+ * @endforcpponly
+ */
+HELICS_EXPORT void
+    helicsFederatePublishBatch(helics_federate fed, const helics_publication* pubs, const double* values, int count, helics_error* err);
+
 /**
  * \defgroup publications Publication functions
  * @details Functions for publishing data of various kinds.
@@ -635,6 +676,24 @@ HELICS_EXPORT int helicsInputGetVectorSize(helics_input ipt);
  */
 HELICS_EXPORT void helicsInputGetVector(helics_input ipt, double data[], int maxLength, int* actualSize, helics_error* err);
 
+/**
+ * Get a read only view of a vector value from a subscription without copying it to user storage.
+ *
+ * @details If the publication sends vectors the elements are read from the received data and copied at most once into an aligned
+ * buffer, the pointer refers directly to the received data when it is already aligned.  Complex vectors are viewed as interleaved
+ * real and imaginary parts.  The data is aligned for double and remains valid until the next call to this function for the same
+ * input or the input is freed.
+ *
+ * @param ipt The input to get the result for.
+ * @param[out] actualSize Location to place the number of doubles in the view.
+ * @forcpponly
+ * @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
+ * @endforcpponly
+ *
+ * @return A pointer to the vector data, may be NULL if the vector is empty or an error occurred.
+ */
+HELICS_EXPORT const double* helicsInputGetVectorView(helics_input ipt, int* actualSize, helics_error* err);
+
 /**
  * Get a named point from a subscription.
  *
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueFederate.h"
 #include "internal/api_objects.h"
 
+#include <algorithm>
 #include <cstring>
 #include <map>
 #include <memory>
@@ -328,6 +329,70 @@ void helicsFederatePublishJSON(helics_federate fed, const char* json, helics_err
     }
 }
 
+void helicsFederatePublishBatch(helics_federate fed, const helics_publication* pubs, const double* values, int count, helics_error* err)
+{
+    auto fedObj = getValueFedSharedPtr(fed, err);
+    if (!fedObj) {
+        return;
+    }
+    if (count <= 0) {
+        return;
+    }
+    if (pubs == nullptr || values == nullptr) {
+        assignError(err, helics_error_invalid_argument, "publication and value arrays must not be null");
+        return;
+    }
+    std::vector<helics::Publication*> pubPtrs(count);
+    for (int ii = 0; ii < count; ++ii) {
+        auto* pubObj = verifyPublication(pubs[ii], err);
+        if (pubObj == nullptr) {
+            return;
+        }
+        pubPtrs[ii] = pubObj->pubPtr;
+    }
+    try {
+        fedObj->publishBatch(pubPtrs.data(), values, count);
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    // LCOV_EXCL_STOP
+}
+
+int helicsFederateGetInputDoubles(helics_federate fed,
+                                  double values[],
+                                  helics_time updateTimes[],
+                                  unsigned char updateMask[],
+                                  int maxCount,
+                                  helics_error* err)
+{
+    auto fedObj = getValueFedSharedPtr(fed, err);
+    if (!fedObj) {
+        return 0;
+    }
+    if (values == nullptr || maxCount <= 0) {
+        return 0;
+    }
+    try {
+        if (updateTimes == nullptr) {
+            return fedObj->getInputDoubles(values, nullptr, updateMask, maxCount);
+        }
+        std::vector<helics::Time> times(std::min(maxCount, fedObj->getInputCount()));
+        auto count = fedObj->getInputDoubles(values, times.data(), updateMask, static_cast<int>(times.size()));
+        for (int ii = 0; ii < count; ++ii) {
+            updateTimes[ii] = static_cast<helics_time>(times[ii]);
+        }
+        return count;
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+    return 0;
+    // LCOV_EXCL_STOP
+}
+
 static constexpr char invalidPubName[] = "the specified publication name is a not a valid publication name";
 static constexpr char invalidPubIndex[] = "the specified publication index is not valid";
 
@@ -932,6 +997,30 @@ void helicsInputGetVector(helics_input inp, double data[], int maxlen, int* actu
     // LCOV_EXCL_STOP
 }
 
+const double* helicsInputGetVectorView(helics_input inp, int* actualSize, helics_error* err)
+{
+    auto* inpObj = verifyInput(inp, err);
+    if (actualSize != nullptr) {
+        *actualSize = 0;
+    }
+    if (inpObj == nullptr) {
+        return nullptr;
+    }
+    try {
+        inpObj->vectorView = inpObj->inputPtr->getVectorView();
+        if (actualSize != nullptr) {
+            *actualSize = static_cast<int>(inpObj->vectorView.size());
+        }
+        return (inpObj->vectorView.empty()) ? nullptr : inpObj->vectorView.data();
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+        return nullptr;
+    }
+    // LCOV_EXCL_STOP
+}
+
 void helicsInputGetNamedPoint(helics_input inp, char* outputString, int maxStringLen, int* actualLength, double* val, helics_error* err)
 {
     auto* inpObj = verifyInput(inp, err);
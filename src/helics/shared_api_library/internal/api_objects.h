@@ -6,12 +6,14 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "../../application_api/VectorView.hpp"
 #include "../../application_api/helicsTypes.hpp"
 #include "../../common/GuardedTypes.hpp"
 #include "../../core/core-data.hpp"
 #include "../api-data.h"
 #include "gmlc/concurrency/TripWire.hpp"
 
+#include <cstddef>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -65,18 +67,35 @@ CoreObject* getCoreObject(helics_core core, helics_error* err) noexcept;
 class InputObject;
 class PublicationObject;
 class EndpointObject;
-/** generalized container for storing messages from a federate*/
+/** generalized container for storing messages from a federate
+@details freed messages are cleared and kept in a pool so later messages reuse the allocation and
+the capacity of the strings and data*/
 class MessageHolder {
   private:
     std::vector<std::unique_ptr<Message>> messages;
     std::vector<int> freeMessageSlots;
+    std::vector<std::unique_ptr<Message>> messagePool;  //!< cleared messages available for reuse
 
   public:
+    /** the maximum number of messages kept in the pool*/
+    static constexpr std::size_t maxPoolSize{1024};
+    /** the largest data capacity kept by a pooled message*/
+    static constexpr std::size_t maxPooledCapacity{65536};
+
     Message* addMessage(std::unique_ptr<Message>& mess);
     Message* newMessage();
     std::unique_ptr<Message> extractMessage(int index);
     void freeMessage(int index);
     void clear();
+    /** get an empty message from the pool or a new one if the pool is empty
+    @details the message is not stored in the holder*/
+    std::unique_ptr<Message> getPooledMessage();
+    /** get the number of messages available for reuse*/
+    std::size_t poolSize() const { return messagePool.size(); }
+
+  private:
+    /** clear a message and place it in the pool*/
+    void recycle(std::unique_ptr<Message> mess);
 };
 /** object wrapping a federate for the c-api*/
 class FedObject {
@@ -103,6 +122,7 @@ class InputObject {
     int valid{0};
     std::shared_ptr<ValueFederate> fedptr;
     Input* inputPtr{nullptr};
+    VectorView<double> vectorView;  //!< storage for the most recent vector view
 };
 
 /** object wrapping a publication*/
@@ -594,4 +594,47 @@ TEST_P(filter_type_tests, test_filter_info_field_ci_skip)
     mFed->finalizeComplete();
 }
 
+/**
+Test a chain of filters applied within the same core
+*/
+TEST_P(filter_type_tests, message_local_filter_chain)
+{
+    auto broker = AddBroker(GetParam(), 1);
+    AddFederates<helics::MessageFederate>(GetParam(), 1, broker, 0.5, "message");
+
+    auto mFed = GetFederateAs<helics::MessageFederate>(0);
+
+    auto& p1 = mFed->registerGlobalEndpoint("port1");
+    auto& p2 = mFed->registerGlobalEndpoint("port2");
+    auto& p3 = mFed->registerGlobalEndpoint("port3");
+
+    auto& f1 = helics::make_filter(helics::filter_types::delay, mFed.get(), "delay1");
+    f1.addSourceTarget("port1");
+    f1.set("delay", 0.5);
+    auto& f2 = helics::make_filter(helics::filter_types::reroute, mFed.get(), "reroute");
+    f2.addSourceTarget("port1");
+    f2.setString("newdestination", "port3");
+    auto& f3 = helics::make_filter(helics::filter_types::delay, mFed.get(), "delay2");
+    f3.addSourceTarget("port1");
+    f3.set("delay", 0.5);
+
+    mFed->enterExecutingMode();
+    helics::data_block data(500, 'a');
+    mFed->sendMessage(p1, "port2", data);
+
+    mFed->requestTime(0.5);
+    EXPECT_FALSE(mFed->hasMessage());
+
+    mFed->requestTime(1.0);
+    EXPECT_FALSE(mFed->hasMessage(p2));
+    ASSERT_TRUE(mFed->hasMessage(p3));
+    auto m2 = mFed->getMessage(p3);
+    EXPECT_EQ(m2->source, "port1");
+    EXPECT_EQ(m2->original_dest, "port2");
+    EXPECT_EQ(m2->time, 1.0);
+    EXPECT_EQ(m2->data.size(), data.size());
+
+    mFed->finalize();
+}
+
 INSTANTIATE_TEST_SUITE_P(filter_tests, filter_type_tests, ::testing::ValuesIn(core_types));
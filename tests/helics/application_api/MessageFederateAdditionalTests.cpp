@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Endpoints.hpp"
 #include "helics/application_api/Filters.hpp"
 #include "helics/application_api/MessageFederate.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/core-exceptions.hpp"
 #include "testFixtures.hpp"
 
@@ -37,6 +38,11 @@ class mfed_add_all_type_tests:
 class mfed_tests: public ::testing::Test, public FederateTestFixture {
 };
 
+class mfed_large_message_tests:
+    public ::testing::TestWithParam<const char*>,
+    public FederateTestFixture {
+};
+
 TEST_P(mfed_add_single_type_tests, initialize_tests)
 {
     SetupTest<helics::MessageFederate>(GetParam(), 1);
@@ -479,6 +485,56 @@ INSTANTIATE_TEST_SUITE_P(mfed_add_tests,
                          mfed_add_all_type_tests,
                          ::testing::ValuesIn(core_types_all));
 
+// messages between the in process cores pass through the broker and must not be split in chunks
+TEST_P(mfed_large_message_tests, send_receive_2fed_large)
+{
+    SetupTest<helics::MessageFederate>(GetParam(), 2);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    auto mFed2 = GetFederateAs<helics::MessageFederate>(1);
+
+    auto& ep1 = mFed1->registerGlobalEndpoint("ep1");
+    auto& ep2 = mFed2->registerGlobalEndpoint("ep2");
+
+    mFed1->setProperty(helics_property_time_delta, 1.0);
+    mFed2->setProperty(helics_property_time_delta, 1.0);
+    auto f1finish = std::async(std::launch::async, [&]() { mFed1->enterExecutingMode(); });
+    mFed2->enterExecutingMode();
+    f1finish.wait();
+
+    // larger than the default chunk size of the network comms
+    helics::data_block data(3 * 1024 * 1024 + 17, 'a');
+    data[1024 * 1024 + 5] = 'b';
+    ep1.send("ep2", data);
+    ep2.send("ep1", "small");
+
+    auto f1time = std::async(std::launch::async, [&]() { return mFed1->requestTime(1.0); });
+    EXPECT_EQ(mFed2->requestTime(1.0), 1.0);
+    EXPECT_EQ(f1time.get(), 1.0);
+
+    auto M2 = ep2.getMessage();
+    ASSERT_TRUE(M2);
+    ASSERT_EQ(M2->data.size(), data.size());
+    EXPECT_EQ(M2->data[1024 * 1024 + 5], 'b');
+    EXPECT_EQ(M2->data.to_string(), data.to_string());
+    auto M1 = ep1.getMessage();
+    ASSERT_TRUE(M1);
+    EXPECT_EQ(M1->to_string(), "small");
+
+    mFed1->finalizeAsync();
+    mFed2->finalize();
+    mFed1->finalizeComplete();
+}
+
+static constexpr const char* large_message_types[] = {
+#ifdef ENABLE_INPROC_CORE
+    "inproc_2",
+#endif
+    "test_2"};
+
+INSTANTIATE_TEST_SUITE_P(mfed_add_tests,
+                         mfed_large_message_tests,
+                         ::testing::ValuesIn(large_message_types));
+
 static constexpr const char* config_files[] = {"example_message_fed.json",
                                                "example_message_fed.toml"};
 
@@ -658,3 +714,278 @@ TEST(messageFederate, constructor5)
     mf1.enterExecutingMode();
     mf1.finalize();
 }
+
+TEST(messageFederate, local_message_names)
+{
+    helics::MessageFederate mf1("--type=test --autobroker --corename=mfnames --name=fedmn");
+    auto& ep1 = mf1.registerEndpoint("ep1");
+    auto& ep2 = mf1.registerGlobalEndpoint("ep2");
+    auto& ep3 = mf1.registerGlobalEndpoint("ep3");
+    auto& filt = helics::make_filter(helics::filter_types::delay, &mf1, "filt");
+    filt.addSourceTarget("ep3");
+    filt.set("delay", 1.0);
+    // the earlier messages would otherwise interrupt the time request before the delayed one
+    mf1.setProperty(helics_property_time_delta, 1.0);
+    mf1.enterExecutingMode();
+
+    // messages between endpoints of the same core keep the names of both endpoints
+    ep1.send("ep2", "a");
+    ep2.send("fedmn/ep1", "b", 0.5);
+    // a filtered message needs the names during the filter processing
+    ep3.send("ep2", "c");
+    EXPECT_EQ(mf1.requestTime(2.0), 1.0);
+
+    ASSERT_EQ(ep2.pendingMessages(), 2U);
+    auto m1 = ep2.getMessage();
+    EXPECT_EQ(m1->to_string(), "a");
+    EXPECT_EQ(m1->source, "fedmn/ep1");
+    EXPECT_EQ(m1->original_source, "fedmn/ep1");
+    EXPECT_EQ(m1->dest, "ep2");
+    auto m2 = ep2.getMessage();
+    EXPECT_EQ(m2->to_string(), "c");
+    EXPECT_EQ(m2->source, "ep3");
+    EXPECT_EQ(m2->original_source, "ep3");
+    EXPECT_EQ(m2->dest, "ep2");
+    EXPECT_EQ(m2->time, 1.0);
+
+    auto m3 = ep1.getMessage();
+    ASSERT_TRUE(m3);
+    EXPECT_EQ(m3->to_string(), "b");
+    EXPECT_EQ(m3->source, "ep2");
+    EXPECT_EQ(m3->dest, "fedmn/ep1");
+    EXPECT_EQ(m3->time, 0.5);
+    mf1.finalize();
+}
+
+TEST(messageFederate, send_receive_batch)
+{
+    helics::MessageFederate mf1("--type=test --autobroker --corename=mfbatch --name=fedbt");
+    auto& ep1 = mf1.registerGlobalEndpoint("ep1");
+    auto& ep2 = mf1.registerGlobalEndpoint("ep2");
+    auto& ep3 = mf1.registerGlobalEndpoint("ep3");
+    mf1.setProperty(helics_property_time_delta, 1.0);
+    mf1.enterExecutingMode();
+
+    std::vector<std::string> payloads;
+    for (int ii = 0; ii < 300; ++ii) {
+        payloads.push_back(std::to_string(ii));
+    }
+    std::vector<helics::data_view> data(payloads.begin(), payloads.end());
+    // more messages than fit in a single core command
+    ep1.sendBatch({"ep2"}, data);
+    // a single message to several destinations
+    mf1.sendBatch(ep2, {"ep1", "ep3"}, {"bcast"}, 0.5);
+    // destinations paired with the messages
+    ep3.sendBatch({"ep2", "ep1"}, {data[0], data[1]});
+    EXPECT_THROW(ep3.sendBatch({"ep1", "ep2"}, {data[0], data[1], data[2]}),
+                 helics::InvalidParameter);
+    EXPECT_EQ(mf1.requestTime(1.0), 1.0);
+
+    EXPECT_EQ(ep2.pendingMessages(), 301U);
+    auto batch = ep2.receiveBatch(250);
+    ASSERT_EQ(batch.size(), 250U);
+    for (int ii = 0; ii < 250; ++ii) {
+        EXPECT_EQ(batch[ii]->to_string(), payloads[ii]);
+        EXPECT_EQ(batch[ii]->source, "ep1");
+    }
+    auto rest = ep2.receiveBatch(100);
+    ASSERT_EQ(rest.size(), 51U);
+    EXPECT_EQ(rest[49]->to_string(), "299");
+    EXPECT_EQ(rest.back()->to_string(), "0");
+    EXPECT_EQ(rest.back()->source, "ep3");
+    EXPECT_FALSE(ep2.hasMessage());
+
+    auto all = mf1.receiveBatch(10);
+    ASSERT_EQ(all.size(), 3U);
+    EXPECT_EQ(all[0]->dest, "ep1");
+    EXPECT_EQ(all[0]->to_string(), "1");
+    EXPECT_EQ(all[1]->dest, "ep1");
+    EXPECT_EQ(all[1]->to_string(), "bcast");
+    EXPECT_EQ(all[1]->time, 0.5);
+    EXPECT_EQ(all[2]->dest, "ep3");
+    EXPECT_EQ(all[2]->to_string(), "bcast");
+    EXPECT_FALSE(mf1.hasMessage());
+    mf1.finalize();
+}
+
+TEST(messageFederate, receive_queue_capacity)
+{
+    helics::MessageFederate mf1("--type=test --autobroker --corename=mfqueue --name=fedq");
+    auto& ep1 = mf1.registerGlobalEndpoint("ep1");
+    auto& ep2 = mf1.registerGlobalEndpoint("ep2");
+    auto& ep3 = mf1.registerGlobalEndpoint("ep3");
+    ep2.setOption(helics_handle_option_receive_queue_capacity, 2);
+    ep2.setOption(helics_handle_option_receive_queue_overflow_policy,
+                  helics_queue_overflow_drop_oldest);
+    ep3.setOption(helics_handle_option_receive_queue_capacity, 2);
+    ep3.setOption(helics_handle_option_receive_queue_overflow_policy,
+                  helics_queue_overflow_drop_newest);
+    EXPECT_EQ(ep3.getOption(helics_handle_option_receive_queue_capacity), 2);
+    EXPECT_EQ(ep3.getOption(helics_handle_option_receive_queue_overflow_policy),
+              helics_queue_overflow_drop_newest);
+    mf1.setProperty(helics_property_time_delta, 1.0);
+    mf1.enterExecutingMode();
+
+    for (int ii = 0; ii < 5; ++ii) {
+        ep1.send("ep2", std::to_string(ii));
+        ep1.send("ep3", std::to_string(ii));
+    }
+    EXPECT_EQ(mf1.requestTime(10.0), 1.0);
+    // only the newest messages are kept
+    EXPECT_EQ(ep2.pendingMessages(), 2U);
+    EXPECT_EQ(ep2.getMessage()->to_string(), "3");
+    // only the oldest messages are kept
+    EXPECT_EQ(ep3.pendingMessages(), 2U);
+    EXPECT_EQ(ep3.getMessage()->to_string(), "0");
+
+    auto local = loadJsonStr(mf1.query("local_endpoint_queues"));
+    ASSERT_EQ(local["endpoints"].size(), 3U);
+    EXPECT_EQ(local["endpoints"][1]["name"].asString(), "ep2");
+    EXPECT_EQ(local["endpoints"][1]["queued"].asInt(), 1);
+    // the messages were already dropped in the core
+    EXPECT_EQ(local["endpoints"][1]["dropped"].asInt(), 0);
+    EXPECT_EQ(local["endpoints"][2]["queued"].asInt(), 1);
+    auto core = loadJsonStr(mf1.query("endpoint_queues"));
+    ASSERT_EQ(core["endpoints"].size(), 3U);
+    EXPECT_EQ(core["endpoints"][1]["dropped"].asInt(), 3);
+    EXPECT_EQ(core["endpoints"][2]["name"].asString(), "ep3");
+    EXPECT_EQ(core["endpoints"][2]["queued"].asInt(), 0);
+    EXPECT_EQ(core["endpoints"][2]["dropped"].asInt(), 3);
+    EXPECT_EQ(core["endpoints"][2]["capacity"].asInt(), 2);
+    EXPECT_EQ(core["endpoints"][2]["policy"].asInt(), helics_queue_overflow_drop_newest);
+
+    EXPECT_EQ(mf1.requestTime(10.0), 10.0);
+    EXPECT_EQ(ep3.pendingMessages(), 1U);
+    mf1.finalize();
+}
+
+TEST(messageFederate, held_message_queues)
+{
+    helics::MessageFederate mf1("--type=test --autobroker --corename=mfheld --name=fedh");
+    auto& ep1 = mf1.registerGlobalEndpoint("ep1");
+    auto& ep2 = mf1.registerGlobalEndpoint("ep2");
+    mf1.setProperty(helics_property_time_delta, 1.0);
+    mf1.enterExecutingMode();
+
+    const std::string data("later");
+    ep1.send("ep1", data, 5.0);
+    ep1.send("ep2", data, 5.0);
+    EXPECT_EQ(mf1.requestTime(2.0), 2.0);
+    // the messages for later times are held by the federate until the time is granted
+    auto core = loadJsonStr(mf1.query("endpoint_queues"));
+    ASSERT_EQ(core["endpoints"].size(), 2U);
+    EXPECT_EQ(core["endpoints"][1]["name"].asString(), "ep2");
+    EXPECT_EQ(core["endpoints"][1]["queued"].asInt(), 1);
+    EXPECT_EQ(core["endpoints"][1]["held"].asInt(), 1);
+    EXPECT_EQ(core["endpoints"][1]["ready"].asInt(), 0);
+
+    // the held messages are discarded along with the queue when the endpoint is closed
+    ep2.close();
+    EXPECT_EQ(mf1.requestTime(10.0), 5.0);
+    EXPECT_EQ(ep1.pendingMessages(), 1U);
+    EXPECT_FALSE(ep2.hasMessage());
+    core = loadJsonStr(mf1.query("endpoint_queues"));
+    EXPECT_EQ(core["endpoints"][1]["queued"].asInt(), 0);
+    EXPECT_EQ(core["endpoints"][1]["held"].asInt(), 0);
+    mf1.finalize();
+}
+
+TEST(messageFederate, held_message_capacity)
+{
+    helics::MessageFederate mf1("--type=test --autobroker --corename=mfheldcap --name=fedhc");
+    auto& ep1 = mf1.registerGlobalEndpoint("ep1");
+    auto& ep2 = mf1.registerGlobalEndpoint("ep2");
+    auto& ep3 = mf1.registerGlobalEndpoint("ep3");
+    ep2.setOption(helics_handle_option_receive_queue_capacity, 2);
+    ep2.setOption(helics_handle_option_receive_queue_overflow_policy,
+                  helics_queue_overflow_drop_newest);
+    ep3.setOption(helics_handle_option_receive_queue_capacity, 2);
+    ep3.setOption(helics_handle_option_receive_queue_overflow_policy,
+                  helics_queue_overflow_drop_oldest);
+    mf1.setProperty(helics_property_time_delta, 1.0);
+    mf1.enterExecutingMode();
+
+    // flood the bounded endpoints with messages for later times
+    for (int ii = 0; ii < 50; ++ii) {
+        ep1.send("ep2", std::to_string(ii), 5.0 + ii * 0.25);
+        ep1.send("ep3", std::to_string(ii), 5.0 + ii * 0.25);
+    }
+    EXPECT_EQ(mf1.requestTime(2.0), 2.0);
+    auto core = loadJsonStr(mf1.query("endpoint_queues"));
+    ASSERT_EQ(core["endpoints"].size(), 3U);
+    // only the capacity of each endpoint is held
+    EXPECT_EQ(core["endpoints"][1]["held"].asInt(), 2);
+    EXPECT_EQ(core["endpoints"][1]["dropped"].asInt(), 48);
+    EXPECT_EQ(core["endpoints"][2]["held"].asInt(), 2);
+    EXPECT_EQ(core["endpoints"][2]["dropped"].asInt(), 48);
+
+    // drop_newest kept the first messages and drop_oldest the last ones
+    EXPECT_EQ(mf1.requestTime(20.0), 5.0);
+    ASSERT_TRUE(ep2.hasMessage());
+    EXPECT_EQ(ep2.getMessage()->to_string(), "0");
+    EXPECT_EQ(mf1.requestTime(20.0), 5.25);
+    EXPECT_EQ(ep2.getMessage()->to_string(), "1");
+    EXPECT_EQ(mf1.requestTime(20.0), 17.0);
+    EXPECT_EQ(mf1.requestTime(20.0), 17.25);
+    EXPECT_EQ(ep3.pendingMessages(), 2U);
+    EXPECT_EQ(ep3.getMessage()->to_string(), "48");
+    EXPECT_EQ(ep3.getMessage()->to_string(), "49");
+    mf1.finalize();
+}
+
+TEST_F(mfed_tests, registered_destination)
+{
+    SetupTest<helics::MessageFederate>("test_2", 2);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    auto mFed2 = GetFederateAs<helics::MessageFederate>(1);
+
+    auto& ep1 = mFed1->registerGlobalEndpoint("ep1");
+    auto& ep3 = mFed1->registerGlobalEndpoint("ep3");
+    auto& ep2 = mFed2->registerGlobalEndpoint("ep2");
+    auto dest2 = mFed1->registerDestination("ep2");
+    EXPECT_EQ(mFed1->registerDestination("ep2"), dest2);
+    auto dest3 = mFed1->registerDestination("ep3");
+    EXPECT_NE(dest3, dest2);
+    ep2.setDefaultDestination("ep1");
+
+    mFed1->setProperty(helics_property_time_delta, 1.0);
+    mFed2->setProperty(helics_property_time_delta, 1.0);
+    auto f1finish = std::async(std::launch::async, [&]() { mFed1->enterExecutingMode(); });
+    mFed2->enterExecutingMode();
+    f1finish.wait();
+
+    // the first message to the other core is sent by name and the later ones by handle
+    for (int ii = 1; ii <= 3; ++ii) {
+        auto data = std::to_string(ii);
+        mFed1->sendMessage(ep1, dest2, data);
+        mFed1->sendMessage(ep1, dest3, data);
+        ep2.send(data);
+
+        auto f1time = std::async(std::launch::async, [&]() { return mFed1->requestTime(ii); });
+        EXPECT_EQ(mFed2->requestTime(ii), ii);
+        EXPECT_EQ(f1time.get(), ii);
+
+        auto m2 = ep2.getMessage();
+        ASSERT_TRUE(m2);
+        EXPECT_EQ(m2->to_string(), data);
+        EXPECT_EQ(m2->source, "ep1");
+        EXPECT_EQ(m2->original_source, "ep1");
+        EXPECT_EQ(m2->dest, "ep2");
+
+        auto m3 = ep3.getMessage();
+        ASSERT_TRUE(m3);
+        EXPECT_EQ(m3->to_string(), data);
+        EXPECT_EQ(m3->source, "ep1");
+        EXPECT_EQ(m3->dest, "ep3");
+
+        auto m1 = ep1.getMessage();
+        ASSERT_TRUE(m1);
+        EXPECT_EQ(m1->to_string(), data);
+        EXPECT_EQ(m1->source, "ep2");
+        EXPECT_EQ(m1->dest, "ep1");
+    }
+    EXPECT_THROW(mFed1->sendMessage(ep1, dest3 + 5, "bad"), helics::InvalidIdentifier);
+    mFed1->finalizeAsync();
+    mFed2->finalize();
+    mFed1->finalizeComplete();
+}
@@ -15,6 +15,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <future>
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 #ifndef HELICS_SHARED_LIBRARY
 #    include "testFixtures.hpp"
 #else
@@ -450,6 +452,87 @@ TEST_F(multiInput, vectorize)
     vFed1->finalize();
 }
 
+TEST_F(multiInput, partial_updates)
+{
+    using namespace helics;
+    SetupTest<ValueFederate>("test", 1, 1.0);
+    auto vFed1 = GetFederateAs<ValueFederate>(0);
+
+    constexpr int pubCount{40};
+    std::vector<Publication*> pubs;
+    auto& sumIn = vFed1->registerInput<double>("sum");
+    auto& avgIn = vFed1->registerInput<double>("avg");
+    auto& maxIn = vFed1->registerInput<std::vector<double>>("max");
+    auto& vecIn = vFed1->registerInput<std::vector<double>>("vec");
+    for (int ii = 0; ii < pubCount; ++ii) {
+        auto name = "pub" + std::to_string(ii);
+        pubs.push_back(&vFed1->registerGlobalPublication(name, "vector"));
+        sumIn.addTarget(name);
+        avgIn.addTarget(name);
+        maxIn.addTarget(name);
+        vecIn.addTarget(name);
+    }
+    sumIn.setOption(helics::defs::multi_input_handling_method,
+                    helics::multi_input_handling_method::sum_operation);
+    avgIn.setOption(helics::defs::multi_input_handling_method,
+                    helics::multi_input_handling_method::average_operation);
+    maxIn.setOption(helics::defs::multi_input_handling_method,
+                    helics::multi_input_handling_method::max_operation);
+    vecIn.setOption(helics::defs::multi_input_handling_method,
+                    helics::multi_input_handling_method::vectorize_operation);
+    vFed1->enterExecutingMode();
+
+    // only half the sources have data
+    for (int ii = 0; ii < pubCount; ii += 2) {
+        pubs[ii]->publish(std::vector<double>{1.0, static_cast<double>(ii)});
+    }
+    vFed1->requestNextStep();
+    EXPECT_DOUBLE_EQ(sumIn.getValue<double>(), 20.0 + 380.0);
+    EXPECT_DOUBLE_EQ(avgIn.getValue<double>(), 400.0 / 40.0);
+    auto vec = vecIn.getValue<std::vector<double>>();
+    ASSERT_EQ(vec.size(), 40U);
+    EXPECT_DOUBLE_EQ(vec[3], 2.0);
+
+    for (int ii = 1; ii < pubCount; ii += 2) {
+        pubs[ii]->publish(std::vector<double>{1.0, static_cast<double>(ii)});
+    }
+    vFed1->requestNextStep();
+    EXPECT_DOUBLE_EQ(sumIn.getValue<double>(), 40.0 + 780.0);
+    vec = vecIn.getValue<std::vector<double>>();
+    ASSERT_EQ(vec.size(), 80U);
+    EXPECT_DOUBLE_EQ(vec[79], 39.0);
+
+    // update a few sources without changing the sizes
+    pubs[5]->publish(std::vector<double>{2.0, 100.0});
+    pubs[30]->publish(std::vector<double>{-1.0, 0.0});
+    vFed1->requestNextStep();
+    EXPECT_DOUBLE_EQ(sumIn.getValue<double>(), 820.0 + 96.0 - 32.0);
+    EXPECT_DOUBLE_EQ(avgIn.getValue<double>(), 884.0 / 80.0);
+    auto mx = maxIn.getValue<std::vector<double>>();
+    ASSERT_EQ(mx.size(), 2U);
+    EXPECT_DOUBLE_EQ(mx[1], 100.0);
+    vec = vecIn.getValue<std::vector<double>>();
+    ASSERT_EQ(vec.size(), 80U);
+    EXPECT_DOUBLE_EQ(vec[10], 2.0);
+    EXPECT_DOUBLE_EQ(vec[11], 100.0);
+    EXPECT_DOUBLE_EQ(vec[60], -1.0);
+    EXPECT_DOUBLE_EQ(vec[61], 0.0);
+    EXPECT_DOUBLE_EQ(vec[79], 39.0);
+
+    // a size change moves the values of the later sources
+    pubs[0]->publish(std::vector<double>{7.0});
+    pubs[39]->publish(std::vector<double>{3.0, 4.0, 5.0});
+    vFed1->requestNextStep();
+    vec = vecIn.getValue<std::vector<double>>();
+    ASSERT_EQ(vec.size(), 80U);
+    EXPECT_DOUBLE_EQ(vec[0], 7.0);
+    EXPECT_DOUBLE_EQ(vec[1], 1.0);
+    EXPECT_DOUBLE_EQ(vec[77], 3.0);
+    EXPECT_DOUBLE_EQ(vec[79], 5.0);
+    EXPECT_DOUBLE_EQ(sumIn.getValue<double>(), 884.0 + 6.0 - 28.0);
+    vFed1->finalize();
+}
+
 TEST_F(multiInput, vectorize_string)
 {
     using namespace helics;
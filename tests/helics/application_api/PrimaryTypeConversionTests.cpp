@@ -5,13 +5,17 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include <cmath>
 #include <complex>
 #include <gtest/gtest.h>
+#include <limits>
 #include <list>
+#include <random>
 #include <set>
 
 /** these test cases test out the value converters
  */
+#include "helics/application_api/ChangeDetectionKernels.hpp"
 #include "helics/application_api/HelicsPrimaryTypes.hpp"
 
 using namespace std::string_literals;
@@ -259,3 +263,63 @@ TEST(type_conversion_tests, bool_conversion_tests)
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, 1.0}, val));
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, -0.5}, val));
 }
+
+TEST(type_conversion_tests, change_detection_kernels)
+{
+    using helics::detail::change_kernel;
+    const change_kernel kernels[] = {change_kernel::scalar,
+                                     change_kernel::sse2,
+                                     change_kernel::avx,
+                                     change_kernel::automatic};
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    for (std::size_t size : {0, 1, 3, 7, 8, 15, 16, 17, 33, 100, 257}) {
+        std::vector<double> base(size);
+        for (auto& val : base) {
+            val = dist(gen);
+        }
+        std::vector<std::complex<double>> cbase(size);
+        for (auto& val : cbase) {
+            val = {dist(gen), dist(gen)};
+        }
+        EXPECT_FALSE(changeDetected(base, base, 0.0));
+        EXPECT_FALSE(changeDetected(cbase, cbase, 0.0));
+        for (std::size_t index = 0; index < size; index += 5) {
+            auto vals = base;
+            auto cvals = cbase;
+            for (double change : {0.05,
+                                  0.1,
+                                  0.1000001,
+                                  0.2,
+                                  std::numeric_limits<double>::quiet_NaN(),
+                                  std::numeric_limits<double>::infinity()}) {
+                vals[index] = base[index] + change;
+                // put the change near the limit on the magnitude rather than either part
+                cvals[index] = cbase[index] + std::complex<double>(change * 0.75, change * 0.7);
+                for (double deltaV : {0.1, 0.0, -1.0}) {
+                    bool expected{false};
+                    bool cexpected{false};
+                    for (std::size_t ii = 0; ii < size; ++ii) {
+                        expected = expected || (std::abs(base[ii] - vals[ii]) > deltaV);
+                        cexpected = cexpected || (std::abs(cbase[ii] - cvals[ii]) > deltaV);
+                    }
+                    for (auto kernel : kernels) {
+                        EXPECT_EQ(helics::detail::anyDifferenceExceeds(
+                                      base.data(), vals.data(), size, deltaV, kernel),
+                                  expected);
+                        EXPECT_EQ(helics::detail::anyDifferenceExceeds(
+                                      cbase.data(), cvals.data(), size, deltaV, kernel),
+                                  cexpected);
+                    }
+                }
+            }
+        }
+    }
+    defV prev = std::vector<double>(40, 1.0);
+    std::vector<double> next(40, 1.0);
+    next[37] = 1.5;
+    EXPECT_FALSE(changeDetected(prev, next, 0.6));
+    EXPECT_TRUE(changeDetected(prev, next, 0.4));
+    EXPECT_TRUE(changeDetected(prev, next.data(), next.size(), 0.4));
+    EXPECT_TRUE(changeDetected(prev, next.data(), 39, 0.4));
+}
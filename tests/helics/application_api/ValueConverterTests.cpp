@@ -5,6 +5,7 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include <algorithm>
 #include <complex>
 #include <gtest/gtest.h>
 #include <list>
@@ -14,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
  */
 #include "helics/application_api/ValueConverter.hpp"
 #include "helics/application_api/ValueConverter_impl.hpp"
+#include "helics/application_api/VectorView.hpp"
 #include "helics/application_api/data_view.hpp"
 #include "helics/core/core-data.hpp"
 
@@ -210,3 +212,109 @@ TEST(valueConverter_tests, errors)
     EXPECT_LT(vb1.size(), 12u);
     EXPECT_GT(vb1.size(), 8u);
 }
+
+/** encode a value through the portable binary archive*/
+template<class X>
+static helics::data_block archiveConvert(const X& val)
+{
+    helics::data_block store;
+    helics::detail::convertValue(val, store, std::false_type{});
+    return store;
+}
+
+TEST(valueConverter_tests, fixed_layout_compatibility)
+{
+    // the fixed layout codec must produce the same bytes as the archive
+    EXPECT_EQ(helics::ValueConverter<double>::convert(-356.56e-27), archiveConvert(-356.56e-27));
+    EXPECT_EQ(helics::ValueConverter<int64_t>::convert(-12351341),
+              archiveConvert(int64_t{-12351341}));
+    std::complex<double> cval{45.7, -19.5};
+    EXPECT_EQ(helics::ValueConverter<std::complex<double>>::convert(cval), archiveConvert(cval));
+    std::vector<double> vval{26.5, 18.6, -48.5, -5.4e-12};
+    EXPECT_EQ(helics::ValueConverter<std::vector<double>>::convert(vval), archiveConvert(vval));
+    EXPECT_EQ(helics::ValueConverter<double>::convert(vval.data(), vval.size()),
+              archiveConvert(vval));
+    std::vector<std::complex<double>> cvval{{26.5, 18.6}, {-48.5, -5.4e-12}};
+    EXPECT_EQ(helics::ValueConverter<std::vector<std::complex<double>>>::convert(cvval),
+              archiveConvert(cvval));
+    helics::NamedPoint npval{"point", 45.7};
+    EXPECT_EQ(helics::ValueConverter<helics::NamedPoint>::convert(npval), archiveConvert(npval));
+
+    // data written by the archive must be readable by the codec
+    EXPECT_EQ(helics::ValueConverter<std::vector<double>>::interpret(archiveConvert(vval)), vval);
+    EXPECT_EQ(helics::ValueConverter<helics::NamedPoint>::interpret(archiveConvert(npval)), npval);
+}
+
+TEST(valueConverter_tests, fixed_layout_endianness)
+{
+    auto blk = helics::ValueConverter<std::vector<double>>::convert(std::vector<double>{1.0, -2.0});
+    // rewrite the data as if it came from a machine with the opposite byte order
+    std::string swapped = blk.to_string();
+    swapped[0] = (swapped[0] == 0) ? 1 : 0;
+    for (size_t ii = 1; ii < swapped.size(); ii += 8) {
+        std::reverse(swapped.begin() + ii, swapped.begin() + ii + 8);
+    }
+    auto val = helics::ValueConverter<std::vector<double>>::interpret(helics::data_view(swapped));
+    ASSERT_EQ(val.size(), 2U);
+    EXPECT_EQ(val[0], 1.0);
+    EXPECT_EQ(val[1], -2.0);
+
+    // unknown layout markers are rejected
+    std::string unknown = helics::ValueConverter<double>::convert(1.0).to_string();
+    unknown[0] = 7;
+    EXPECT_THROW(helics::ValueConverter<double>::interpret(helics::data_view(unknown)),
+                 std::invalid_argument);
+    // truncated vectors are rejected
+    std::string truncated = blk.to_string();
+    truncated.pop_back();
+    EXPECT_THROW(helics::ValueConverter<std::vector<double>>::interpret(
+                     helics::data_view(truncated)),
+                 std::invalid_argument);
+}
+
+TEST(valueConverter_tests, vector_view)
+{
+    std::vector<double> vval{26.5, 18.6, -48.5, -5.4e-12};
+    // the view does not own data referenced from a data_block
+    auto blk = helics::ValueConverter<std::vector<double>>::convert(vval);
+    helics::VectorView<double> view(blk, helics::data_type::helics_vector);
+    ASSERT_TRUE(view.valid());
+    EXPECT_TRUE(view.isZeroCopy());
+    ASSERT_EQ(view.size(), vval.size());
+    EXPECT_EQ(view[2], -48.5);
+    EXPECT_EQ(std::vector<double>(view.begin(), view.end()), vval);
+    const double* data = view.data();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data) % alignof(double), 0U);
+    EXPECT_TRUE(std::equal(vval.begin(), vval.end(), data));
+    EXPECT_THROW(view.at(4), std::out_of_range);
+
+    std::vector<std::complex<double>> cvval{{26.5, 18.6}, {-48.5, -5.4e-12}};
+    auto cblk = helics::ValueConverter<std::vector<std::complex<double>>>::convert(cvval);
+    helics::VectorView<std::complex<double>> cview(cblk, helics::data_type::helics_complex_vector);
+    ASSERT_TRUE(cview.valid());
+    EXPECT_EQ(cview.toVector(), cvval);
+    // a double view of complex data is interleaved
+    helics::VectorView<double> iview(cblk, helics::data_type::helics_complex_vector);
+    ASSERT_EQ(iview.size(), 4U);
+    EXPECT_EQ(iview[1], 18.6);
+    EXPECT_EQ(iview[2], -48.5);
+    // complex views of double data are not possible
+    helics::VectorView<std::complex<double>> bview(blk, helics::data_type::helics_vector);
+    EXPECT_FALSE(bview.valid());
+
+    // data from a machine with the opposite byte order
+    std::string swapped = blk.to_string();
+    swapped[0] = (swapped[0] == 0) ? 1 : 0;
+    for (size_t ii = 1; ii < swapped.size(); ii += 8) {
+        std::reverse(swapped.begin() + ii, swapped.begin() + ii + 8);
+    }
+    helics::VectorView<double> sview(helics::data_view(swapped), helics::data_type::helics_vector);
+    ASSERT_TRUE(sview.valid());
+    EXPECT_EQ(sview[3], -5.4e-12);
+    EXPECT_EQ(sview.toVector(), vval);
+
+    std::string truncated = blk.to_string();
+    truncated.pop_back();
+    helics::VectorView<double> tview(helics::data_view(truncated), helics::data_type::helics_vector);
+    EXPECT_FALSE(tview.valid());
+}
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "ValueFederateTestTemplates.hpp"
 #include "helics/application_api/CoreApp.hpp"
+#include "helics/application_api/InputBatchCallback.hpp"
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/application_api/ValueFederate.hpp"
@@ -14,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/CoreFactory.hpp"
 #include "testFixtures.hpp"
 
+#include <algorithm>
 #include <future>
 #include <gtest/gtest.h>
 
@@ -1060,6 +1062,173 @@ TEST(valuefederate, update_query)
     Fed1->finalize();
 }
 
+TEST(valuefederate, publish_batch)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "core_pub_batch";
+    fi.coreInitString = "-f 2 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fi);
+    auto Fed2 = std::make_shared<helics::ValueFederate>("vfed2", fi);
+    std::vector<helics::Publication*> pubs;
+    std::vector<helics::Input*> subs1;
+    std::vector<helics::Input*> subs2;
+    for (int ii = 0; ii < 300; ++ii) {
+        pubs.push_back(&Fed1->registerIndexedPublication<double>("pub", ii));
+    }
+    for (int ii = 0; ii < 300; ++ii) {
+        subs1.push_back(&Fed1->registerIndexedSubscription("pub", ii));
+        subs2.push_back(&Fed2->registerIndexedSubscription("pub", ii));
+    }
+    pubs[5]->setMinimumChange(1.0);
+    std::vector<double> vals(300);
+    for (int ii = 0; ii < 300; ++ii) {
+        vals[ii] = 0.5 * ii;
+    }
+    Fed1->enterExecutingModeAsync();
+    Fed2->enterExecutingMode();
+    Fed1->enterExecutingModeComplete();
+
+    Fed1->publishBatch(pubs, vals);
+    Fed1->requestTimeAsync(1.0);
+    Fed2->requestTime(1.0);
+    Fed1->requestTimeComplete();
+    for (int ii = 0; ii < 300; ++ii) {
+        EXPECT_TRUE(subs1[ii]->isUpdated());
+        EXPECT_DOUBLE_EQ(subs1[ii]->getValue<double>(), vals[ii]);
+        EXPECT_DOUBLE_EQ(subs2[ii]->getValue<double>(), vals[ii]);
+    }
+    // the change detection on each publication is still applied
+    vals[5] += 0.5;
+    vals[7] += 0.5;
+    Fed1->publishBatch(pubs.data(), vals.data(), 10);
+    Fed1->requestTimeAsync(2.0);
+    Fed2->requestTime(2.0);
+    Fed1->requestTimeComplete();
+    EXPECT_FALSE(subs2[5]->isUpdated());
+    EXPECT_DOUBLE_EQ(subs2[5]->getValue<double>(), 2.5);
+    EXPECT_TRUE(subs2[7]->isUpdated());
+    EXPECT_DOUBLE_EQ(subs2[7]->getValue<double>(), vals[7]);
+    EXPECT_FALSE(subs2[20]->isUpdated());
+
+    EXPECT_THROW(Fed1->publishBatch(pubs, std::vector<double>(3)), helics::InvalidParameter);
+    Fed1->finalize();
+    Fed2->finalize();
+}
+
+TEST(valuefederate, get_input_doubles)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "core_input_doubles";
+    fi.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fi);
+    auto& p1 = Fed1->registerGlobalPublication<double>("pub1", "m");
+    auto& p2 = Fed1->registerGlobalPublication<int64_t>("pub2");
+    auto& p3 = Fed1->registerGlobalPublication<std::string>("pub3");
+    Fed1->registerSubscription("pub1");
+    Fed1->registerSubscription("pub2");
+    auto& s3 = Fed1->registerSubscription("pub3");
+    Fed1->registerSubscription("pub1", "cm");
+    Fed1->enterExecutingMode();
+
+    std::vector<double> vals(4, -1.0);
+    std::vector<helics::Time> times(4);
+    std::vector<std::uint8_t> mask(1, 0xFF);
+    p1.publish(2.5);
+    p2.publish(7);
+    p3.publish("19.25");
+    Fed1->requestTime(1.0);
+    EXPECT_EQ(Fed1->getInputDoubles(vals.data(), times.data(), mask.data(), 4), 4);
+    EXPECT_DOUBLE_EQ(vals[0], 2.5);
+    EXPECT_DOUBLE_EQ(vals[1], 7.0);
+    EXPECT_DOUBLE_EQ(vals[2], 19.25);
+    EXPECT_DOUBLE_EQ(vals[3], 250.0);
+    EXPECT_EQ(mask[0], 0x0F);
+    EXPECT_EQ(times[2], 1.0);
+    EXPECT_FALSE(s3.isUpdated());
+
+    p2.publish(9);
+    Fed1->requestTime(2.0);
+    EXPECT_EQ(Fed1->getInputDoubles(vals.data(), times.data(), mask.data(), 4), 4);
+    EXPECT_EQ(mask[0], 0x02);
+    EXPECT_DOUBLE_EQ(vals[0], 2.5);
+    EXPECT_DOUBLE_EQ(vals[1], 9.0);
+    EXPECT_EQ(times[0], 1.0);
+    EXPECT_EQ(times[1], 2.0);
+    // the arrays may be shorter than the number of inputs and the optional outputs omitted
+    EXPECT_EQ(Fed1->getInputDoubles(vals.data(), nullptr, nullptr, 2), 2);
+    Fed1->finalize();
+}
+
+TEST(valuefederate, input_batch_callback)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "core_input_batch";
+    fi.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fi);
+    auto& p1 = Fed1->registerGlobalPublication<double>("pub1", "m");
+    auto& p2 = Fed1->registerGlobalPublication<int64_t>("pub2");
+    auto& p3 = Fed1->registerGlobalPublication<double>("pub3");
+    auto& s1 = Fed1->registerSubscription("pub1", "cm");
+    auto& s2 = Fed1->registerSubscription("pub2");
+    Fed1->registerSubscription("pub3");
+
+    int individualCount{0};
+    int allCount{0};
+    int batchCount{0};
+    std::vector<std::pair<std::string, double>> delivered;
+    Fed1->setInputNotificationCallback(s1, [&](helics::Input&, helics::Time) {
+        ++individualCount;
+    });
+    Fed1->setInputNotificationCallback([&](helics::Input&, helics::Time) { ++allCount; });
+    helics::setInputBatchCallback<double>(
+        *Fed1, {&s1, &s2}, [&](helics::Input& inp, const double& val, helics::Time tm) {
+            EXPECT_EQ(tm, Fed1->getCurrentTime());
+            if (delivered.empty()) {
+                ++batchCount;
+            }
+            delivered.emplace_back(inp.getTarget(), val);
+        });
+    helics::Input invalid;
+    EXPECT_THROW(helics::setInputBatchCallback<double>(
+                     *Fed1, {&invalid}, [](helics::Input&, const double&, helics::Time) {}),
+                 helics::InvalidIdentifier);
+    Fed1->enterExecutingMode();
+
+    p1.publish(2.5);
+    p2.publish(7);
+    p3.publish(1.0);
+    Fed1->requestTime(1.0);
+    EXPECT_EQ(batchCount, 1);
+    ASSERT_EQ(delivered.size(), 2U);
+    std::sort(delivered.begin(), delivered.end());
+    EXPECT_EQ(delivered[0].first, "pub1");
+    EXPECT_DOUBLE_EQ(delivered[0].second, 250.0);
+    EXPECT_EQ(delivered[1].first, "pub2");
+    EXPECT_DOUBLE_EQ(delivered[1].second, 7.0);
+    // the grouped inputs no longer trigger the other callbacks
+    EXPECT_EQ(individualCount, 0);
+    EXPECT_EQ(allCount, 1);
+
+    delivered.clear();
+    p2.publish(9);
+    Fed1->requestTime(2.0);
+    EXPECT_EQ(batchCount, 2);
+    ASSERT_EQ(delivered.size(), 1U);
+    EXPECT_DOUBLE_EQ(delivered[0].second, 9.0);
+    EXPECT_FALSE(s2.isUpdated());
+
+    delivered.clear();
+    p3.publish(3.0);
+    Fed1->requestTime(3.0);
+    EXPECT_EQ(batchCount, 2);
+    EXPECT_TRUE(delivered.empty());
+    EXPECT_EQ(allCount, 2);
+    Fed1->finalize();
+}
+
 TEST(valuefederate, indexed_targets)
 {
     helics::FederateInfo fi(helics::core_type::TEST);
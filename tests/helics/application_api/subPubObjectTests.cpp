@@ -421,6 +421,85 @@ TEST(subscriptionObject, VectorSize_tests)
     vFed->finalize();
 }
 
+TEST(subscriptionObject, vector_view)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreInitString = "--autobroker";
+
+    auto vFed = std::make_shared<helics::ValueFederate>("test1", fi);
+    auto pubObj = helics::make_publication<std::vector<double>>(helics::GLOBAL,
+                                                                vFed.get(),
+                                                                std::string("pub1"));
+
+    auto& subObj = vFed->registerSubscription("pub1");
+
+    vFed->setProperty(helics_property_time_delta, 1.0);
+    vFed->enterExecutingMode();
+    std::vector<double> tvec{5, 7, 234.23, 99.1, 1e7, 0.0};
+    pubObj->publish(tvec);
+    vFed->requestTime(1.0);
+
+    EXPECT_TRUE(subObj.isUpdated());
+    auto view = subObj.getVectorView();
+    EXPECT_TRUE(view.isZeroCopy());
+    EXPECT_FALSE(subObj.isUpdated());
+    EXPECT_EQ(view.toVector(), tvec);
+
+    std::vector<double> tvec2{1.0, 2.0};
+    pubObj->publish(tvec2);
+    vFed->requestTime(2.0);
+    // the view holds the data from the previous time
+    EXPECT_EQ(view.toVector(), tvec);
+    // values retrieved after a view must match the view
+    EXPECT_EQ(subObj.getVectorView().toVector(), tvec2);
+    EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec2);
+    EXPECT_EQ(subObj.getVectorView().toVector(), tvec2);
+
+    auto cview = subObj.getComplexVectorView();
+    EXPECT_FALSE(cview.isZeroCopy());
+    ASSERT_EQ(cview.size(), 2U);
+    EXPECT_EQ(cview[1], std::complex<double>(2.0, 0.0));
+    vFed->finalize();
+}
+
+TEST(subscriptionObject, vector_delta_publication)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreInitString = "--autobroker";
+
+    auto vFed = std::make_shared<helics::ValueFederate>("test1", fi);
+    auto pubObj = helics::make_publication<std::vector<double>>(helics::GLOBAL,
+                                                                vFed.get(),
+                                                                std::string("pub1"));
+    pubObj->setMinimumChange(0.0);
+    pubObj->setDeltaEncoding(3);
+    auto& subObj = vFed->registerSubscription("pub1");
+
+    vFed->setProperty(helics_property_time_delta, 1.0);
+    vFed->enterExecutingMode();
+    std::vector<double> tvec(200, 1.0);
+    pubObj->publish(tvec);
+    vFed->requestTime(1.0);
+    EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec);
+    for (int ii = 0; ii < 8; ++ii) {
+        tvec[ii * 7] += 2.0;
+        tvec[199 - ii] = -1.0 * ii;
+        pubObj->publish(tvec);
+        // publish twice in a time step to check the deltas are applied in sequence
+        tvec[100] += 0.5;
+        pubObj->publish(tvec);
+        vFed->requestTimeAdvance(1.0);
+        EXPECT_TRUE(subObj.isUpdated());
+        EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec);
+    }
+    // size changes are sent as full values
+    tvec.resize(20);
+    pubObj->publish(tvec);
+    vFed->requestTimeAdvance(1.0);
+    EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec);
+    vFed->finalize();
+}
+
 TEST(subscriptionObject, Defaults_test)
 {
     helics::FederateInfo fi(CORE_TYPE_TO_TEST);
@@ -569,3 +648,93 @@ TEST(inputObject, units)
     EXPECT_NEAR(val3, 40.0, 0.0001);
     vFed->finalize();
 }
+
+TEST(inputObject, unit_conversion_plan)
+{
+    auto kW = std::make_shared<units::precise_unit>(units::unit_from_string("kW"));
+    auto MW = std::make_shared<units::precise_unit>(units::unit_from_string("MW"));
+    auto degC = std::make_shared<units::precise_unit>(units::unit_from_string("degC"));
+    auto degF = std::make_shared<units::precise_unit>(units::unit_from_string("degF"));
+
+    helics::UnitConversionPlan same(kW, kW);
+    EXPECT_TRUE(same.isIdentity());
+    EXPECT_TRUE(helics::UnitConversionPlan(kW, nullptr).isIdentity());
+    EXPECT_TRUE(helics::UnitConversionPlan(nullptr, MW).isIdentity());
+
+    helics::UnitConversionPlan power(kW, MW);
+    EXPECT_FALSE(power.isIdentity());
+    EXPECT_DOUBLE_EQ(power.getScale(), 0.001);
+    EXPECT_EQ(power.getOffset(), 0.0);
+    EXPECT_DOUBLE_EQ(power.apply(2500.0), 2.5);
+
+    helics::UnitConversionPlan temperature(degC, degF);
+    EXPECT_NEAR(temperature.getOffset(), 32.0, 1e-9);
+    EXPECT_NEAR(temperature.apply(100.0), units::convert(100.0, *degC, *degF), 1e-9);
+
+    std::vector<double> vals(37);
+    for (std::size_t ii = 0; ii < vals.size(); ++ii) {
+        vals[ii] = static_cast<double>(ii) * 10.0 - 55.0;
+    }
+    auto expected = vals;
+    temperature.apply(vals.data(), vals.size());
+    for (std::size_t ii = 0; ii < vals.size(); ++ii) {
+        EXPECT_NEAR(vals[ii], units::convert(expected[ii], *degC, *degF), 1e-9);
+    }
+
+    std::vector<std::complex<double>> cvals{{1000.0, -500.0}, {3.0, 4.0}};
+    power.apply(cvals.data(), cvals.size());
+    EXPECT_DOUBLE_EQ(cvals[0].real(), 1.0);
+    EXPECT_DOUBLE_EQ(cvals[0].imag(), -0.5);
+    // an offset has no meaning for complex values so they are not modified
+    temperature.apply(cvals.data(), cvals.size());
+    EXPECT_DOUBLE_EQ(cvals[1].imag(), 0.004);
+}
+
+TEST(inputObject, vector_units)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreInitString = "--autobroker";
+
+    auto vFed = std::make_shared<helics::ValueFederate>("test1", fi);
+
+    auto& p1 = vFed->registerGlobalPublication<std::vector<double>>("pub1", "kW");
+    auto& p2 = vFed->registerGlobalPublication<std::vector<std::complex<double>>>("pub2", "kV");
+    auto& sub1 = vFed->registerSubscription("pub1", "MW");
+    auto& sub2 = vFed->registerSubscription("pub1");
+    auto& sub3 = vFed->registerSubscription("pub2", "V");
+
+    vFed->enterExecutingMode();
+    std::vector<double> tvec{1500.0, -250.0, 0.0, 12.0};
+    p1.publish(tvec);
+    p2.publish(std::vector<std::complex<double>>{{1.0, -2.0}, {0.5, 0.25}});
+    vFed->requestTime(1.0);
+
+    auto val1 = sub1.getValue<std::vector<double>>();
+    ASSERT_EQ(val1.size(), tvec.size());
+    EXPECT_NEAR(val1[0], 1.5, 1e-12);
+    EXPECT_NEAR(val1[1], -0.25, 1e-12);
+    EXPECT_NEAR(val1[3], 0.012, 1e-12);
+    // no units on the input so the values are not converted
+    EXPECT_EQ(sub2.getValue<std::vector<double>>(), tvec);
+
+    auto cval = sub3.getValue<std::vector<std::complex<double>>>();
+    ASSERT_EQ(cval.size(), 2U);
+    EXPECT_NEAR(cval[0].real(), 1000.0, 1e-9);
+    EXPECT_NEAR(cval[0].imag(), -2000.0, 1e-9);
+
+    p1.publish(tvec);
+    vFed->requestTime(2.0);
+    // the view must return converted values so it cannot reference the received data
+    auto view = sub1.getVectorView();
+    EXPECT_FALSE(view.isZeroCopy());
+    ASSERT_EQ(view.size(), tvec.size());
+    EXPECT_NEAR(view[0], 1.5, 1e-12);
+
+    p1.publish(tvec);
+    vFed->requestTime(3.0);
+    double raw[4];
+    EXPECT_EQ(sub1.getValue(raw, 4), 4);
+    EXPECT_NEAR(raw[2], 0.0, 1e-12);
+    EXPECT_NEAR(raw[3], 0.012, 1e-12);
+    vFed->finalize();
+}
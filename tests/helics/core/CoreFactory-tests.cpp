@@ -11,6 +11,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/network/loadCores.hpp"
 
 #include "gtest/gtest.h"
+#include <chrono>
+#include <string>
+#include <thread>
 
 static const bool ld = helics::loadCores();
 
@@ -134,3 +137,33 @@ TEST(CoreFactory_tests, udpCore_test)
     EXPECT_EQ(helics::core::isCoreTypeAvailable(helics::core_type::UDP), false);
 }
 #endif
+
+TEST(CoreFactory_tests, corePool_test)
+{
+    const std::string config{"--autobroker"};
+    helics::CoreFactory::setCorePool(helics::core_type::TEST, config, 2);
+    int cnt{0};
+    while (helics::CoreFactory::getPooledCoreCount(helics::core_type::TEST) < 2 && cnt < 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++cnt;
+    }
+    EXPECT_EQ(helics::CoreFactory::getPooledCoreCount(helics::core_type::TEST), 2U);
+
+    auto core = helics::CoreFactory::create(helics::core_type::TEST, config);
+    ASSERT_TRUE(core);
+    EXPECT_TRUE(core->isConfigured());
+    EXPECT_EQ(helics::CoreFactory::findCore(core->getIdentifier()), core);
+    core->disconnect();
+    core = nullptr;
+
+    // a different configuration should not come from the pool
+    auto core2 = helics::CoreFactory::create(helics::core_type::TEST, "--autobroker --name=core2");
+    ASSERT_TRUE(core2);
+    EXPECT_EQ(core2->getIdentifier(), "core2");
+    core2->disconnect();
+    core2 = nullptr;
+
+    helics::CoreFactory::clearCorePools();
+    EXPECT_EQ(helics::CoreFactory::getPooledCoreCount(helics::core_type::TEST), 0U);
+    helics::CoreFactory::cleanUpCores(std::chrono::milliseconds(200));
+}
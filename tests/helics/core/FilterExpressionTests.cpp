@@ -0,0 +1,116 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/FilterExpression.hpp"
+#include "helics/core/core-exceptions.hpp"
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::unique_ptr<helics::Message>
+    testMessage(const std::string& source, const std::string& dest, const std::string& payload)
+{
+    auto message = std::make_unique<helics::Message>();
+    message->source = source;
+    message->original_source = source;
+    message->dest = dest;
+    message->data = payload;
+    message->time = 1.0;
+    return message;
+}
+
+TEST(filter_expression, conditions)
+{
+    helics::FilterExpression expr(
+        "if size > 10 and dest ~ fed2/* then delay 0.5; if payload ~ 'ERR*' then drop");
+    EXPECT_EQ(expr.ruleCount(), 2U);
+
+    auto res = expr.evaluate(testMessage("fed1/ep", "fed2/ep", "a longer payload"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->time, 1.5);
+
+    res = expr.evaluate(testMessage("fed1/ep", "fed3/ep", "a longer payload"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->time, 1.0);
+
+    res = expr.evaluate(testMessage("fed1/ep", "fed2/ep", "short"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->time, 1.0);
+
+    res = expr.evaluate(testMessage("fed1/ep", "fed2/ep", "ERROR 42"), nullptr);
+    EXPECT_FALSE(res);
+}
+
+TEST(filter_expression, logic)
+{
+    helics::FilterExpression expr("if not (source == a or source == b) and source !~ 'c?' then "
+                                  "reroute sink\nif source == a then pass; reroute other");
+
+    auto res = expr.evaluate(testMessage("d", "dest", "data"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->dest, "other");
+    EXPECT_EQ(res->original_dest, "sink");
+
+    res = expr.evaluate(testMessage("a", "dest", "data"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->dest, "dest");
+
+    res = expr.evaluate(testMessage("c1", "dest", "data"), nullptr);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->dest, "other");
+    EXPECT_EQ(res->original_dest, "dest");
+}
+
+TEST(filter_expression, clone)
+{
+    helics::ExpressionFilterOperator op(
+        std::make_shared<const helics::FilterExpression>("if time >= 1 then clone c1, clone c2"));
+    auto clones = op.processVector(testMessage("src", "dest", "data"));
+    ASSERT_EQ(clones.size(), 2U);
+    EXPECT_EQ(clones[0]->dest, "c1");
+    EXPECT_EQ(clones[1]->dest, "c2");
+    EXPECT_EQ(clones[1]->original_dest, "dest");
+
+    // clone actions do nothing outside of a cloning filter
+    auto res = op.process(testMessage("src", "dest", "data"));
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->dest, "dest");
+}
+
+TEST(filter_expression, invalid)
+{
+    EXPECT_THROW(helics::FilterExpression("if size ~ 10 then drop"), helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("if color == red then drop"), helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("if source == a drop"), helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("explode"), helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("if (size > 3 then drop"), helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("if source == 'a then drop"), helics::InvalidParameter);
+}
+
+TEST(filter_expression, deep_nesting)
+{
+    std::string nots;
+    for (int ii = 0; ii < 60; ++ii) {
+        nots += "not ";
+    }
+    helics::FilterExpression expr("if " + nots + "(((size > 3))) then drop");
+    EXPECT_FALSE(expr.evaluate(testMessage("a", "b", "long message"), nullptr));
+
+    // the nesting is rejected long before it is deep enough to exhaust the stack
+    const int deep{1000000};
+    nots.clear();
+    for (int ii = 0; ii < deep; ++ii) {
+        nots += "not ";
+    }
+    EXPECT_THROW(helics::FilterExpression("if " + nots + "size > 3 then drop"),
+                 helics::InvalidParameter);
+    EXPECT_THROW(helics::FilterExpression("if " + std::string(deep, '(') + "size > 3" +
+                                          std::string(deep, ')') + " then drop"),
+                 helics::InvalidParameter);
+}
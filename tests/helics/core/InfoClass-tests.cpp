@@ -8,8 +8,20 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/EndpointInfo.hpp"
 #include "helics/core/FilterInfo.hpp"
 #include "helics/core/InputInfo.hpp"
+#include "helics/core/MetadataArena.hpp"
+#include "helics/core/PublicationInfo.hpp"
+#include "helics/core/RingBufferQueue.hpp"
+#include "helics/core/VectorDelta.hpp"
+#include "helics/helics_enums.h"
 
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
 
 TEST(InfoClass_tests, basichandleinfo_test)
 {
@@ -231,6 +243,172 @@ TEST(InfoClass_tests, endpointinfo_test)
     EXPECT_TRUE(endPI.getMessage(maxT) == nullptr);
 }
 
+TEST(InfoClass_tests, endpointinfo_order_test)
+{
+    helics::EndpointInfo endPI({helics::global_federate_id(5), helics::interface_handle(13)},
+                               "name",
+                               "type");
+    // messages added in order, out of order, and at equal times from several sources
+    const std::vector<std::pair<double, std::string>> adds{
+        {1.0, "b"}, {2.0, "a"}, {3.0, "a"}, {2.0, "c"}, {0.5, "a"}, {2.0, "a"}, {3.0, "a"},
+        {1.0, "a"}, {4.0, "b"}, {2.0, "b"}, {2.5, "a"}, {2.0, "c"}};
+    int index{0};
+    for (const auto& add : adds) {
+        auto msg = std::make_unique<helics::Message>();
+        msg->time = add.first;
+        msg->original_source = add.second;
+        msg->data = std::to_string(index++);
+        endPI.addMessage(std::move(msg));
+        if (index == 6) {
+            // read part way through to check the ordered part is merged with later additions
+            EXPECT_EQ(endPI.firstMessageTime(), 0.5);
+            EXPECT_EQ(endPI.queueSize(2.0), 5);
+        }
+    }
+    EXPECT_EQ(endPI.queueSize(0.4), 0);
+    EXPECT_EQ(endPI.queueSize(2.0), 8);
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 12);
+    EXPECT_EQ(endPI.firstMessageTime(), 0.5);
+    // ordered by time then source with equal messages in the order they were added
+    const std::vector<std::string> expected{
+        "4", "7", "0", "1", "5", "9", "3", "11", "10", "2", "6", "8"};
+    for (const auto& exp : expected) {
+        auto msg = endPI.getMessage(helics::Time::maxVal());
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg->data.to_string(), exp);
+    }
+    EXPECT_TRUE(endPI.getMessage(helics::Time::maxVal()) == nullptr);
+
+    auto late = std::make_unique<helics::Message>();
+    late->time = 1.0;
+    endPI.addMessage(std::move(late));
+    endPI.clearQueue();
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 0);
+    EXPECT_EQ(endPI.firstMessageTime(), helics::Time::maxVal());
+}
+
+TEST(InfoClass_tests, endpointinfo_source_handle_test)
+{
+    helics::EndpointInfo endPI({helics::global_federate_id(5), helics::interface_handle(13)},
+                               "name",
+                               "type");
+    const std::vector<std::string> names{"c", "a"};
+    int lookups{0};
+    endPI.setSourceNameLookup(
+        [&names, &lookups](helics::interface_handle handle) -> const std::string& {
+            ++lookups;
+            return names[handle.baseValue()];
+        });
+    auto addMessage = [&endPI](double time, int source, const std::string& data) {
+        auto msg = std::make_unique<helics::Message>();
+        msg->time = time;
+        msg->source_handle = helics::interface_handle(source);
+        msg->data = data;
+        endPI.addMessage(std::move(msg));
+    };
+    addMessage(1.0, 0, "0");
+    addMessage(2.0, 0, "1");
+    // the names are not needed to order messages with different times
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 2);
+    EXPECT_EQ(lookups, 0);
+
+    addMessage(2.0, 1, "2");
+    auto named = std::make_unique<helics::Message>();
+    named->time = 2.0;
+    named->original_source = "b";
+    named->data = "3";
+    endPI.addMessage(std::move(named));
+    // messages with the same time are ordered by the source names
+    const std::vector<std::string> expected{"0", "2", "3", "1"};
+    for (const auto& exp : expected) {
+        auto msg = endPI.getMessage(helics::Time::maxVal());
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg->data.to_string(), exp);
+        EXPECT_FALSE(msg->source_handle.isValid());
+    }
+    EXPECT_TRUE(endPI.getMessage(helics::Time::maxVal()) == nullptr);
+
+    // the names are filled in when the message is retrieved
+    addMessage(3.0, 1, "4");
+    auto msg = endPI.getMessage(helics::Time::maxVal());
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(msg->source, "a");
+    EXPECT_EQ(msg->original_source, "a");
+    EXPECT_EQ(msg->dest, "name");
+}
+
+TEST(InfoClass_tests, endpointinfo_capacity_test)
+{
+    helics::EndpointInfo endPI({helics::global_federate_id(5), helics::interface_handle(13)},
+                               "name",
+                               "type");
+    auto addMessages = [&endPI](int count, double start) {
+        for (int ii = 0; ii < count; ++ii) {
+            auto msg = std::make_unique<helics::Message>();
+            msg->time = start + ii;
+            msg->data = std::to_string(ii);
+            endPI.addMessage(std::move(msg));
+        }
+    };
+    EXPECT_EQ(endPI.getQueueCapacity(), 0);
+    EXPECT_EQ(endPI.getOverflowPolicy(), helics_queue_overflow_drop_oldest);
+    endPI.setQueueCapacity(3);
+    EXPECT_EQ(endPI.getQueueCapacity(), 3);
+    // the oldest messages are removed to make room
+    addMessages(5, 1.0);
+    EXPECT_EQ(endPI.totalQueueSize(), 3);
+    EXPECT_EQ(endPI.droppedCount(), 2U);
+    EXPECT_EQ(endPI.firstMessageTime(), 3.0);
+    endPI.clearQueue();
+
+    endPI.setOverflowPolicy(helics_queue_overflow_drop_newest);
+    addMessages(5, 1.0);
+    EXPECT_EQ(endPI.totalQueueSize(), 3);
+    EXPECT_EQ(endPI.droppedCount(), 4U);
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 3);
+    auto msg = endPI.getMessage(helics::Time::maxVal());
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(msg->time, 1.0);
+    endPI.clearQueue();
+
+    endPI.setQueueCapacity(-1);
+    EXPECT_EQ(endPI.getQueueCapacity(), 0);
+}
+
+TEST(InfoClass_tests, endpointinfo_held_capacity_test)
+{
+    helics::EndpointInfo endPI({helics::global_federate_id(5), helics::interface_handle(13)},
+                               "name",
+                               "type");
+    endPI.setQueueCapacity(3);
+    auto msg = std::make_unique<helics::Message>();
+    msg->time = 1.0;
+    endPI.addMessage(std::move(msg));
+    // the held messages count against the capacity along with the queued ones
+    EXPECT_EQ(endPI.holdMessage(), helics::held_message_action::hold);
+    EXPECT_EQ(endPI.holdMessage(), helics::held_message_action::hold);
+    EXPECT_EQ(endPI.heldCount(), 2);
+    // the queued message is older than any held message so it is dropped first
+    EXPECT_EQ(endPI.holdMessage(), helics::held_message_action::hold);
+    EXPECT_EQ(endPI.totalQueueSize(), 0);
+    EXPECT_EQ(endPI.heldCount(), 3);
+    EXPECT_EQ(endPI.holdMessage(), helics::held_message_action::replace_oldest);
+    EXPECT_EQ(endPI.heldCount(), 3);
+    EXPECT_EQ(endPI.droppedCount(), 2U);
+
+    endPI.setOverflowPolicy(helics_queue_overflow_drop_newest);
+    EXPECT_EQ(endPI.holdMessage(), helics::held_message_action::discard);
+    EXPECT_EQ(endPI.droppedCount(), 3U);
+
+    msg = std::make_unique<helics::Message>();
+    msg->time = 4.0;
+    endPI.addHeldMessage(std::move(msg));
+    EXPECT_EQ(endPI.heldCount(), 2);
+    EXPECT_EQ(endPI.totalQueueSize(), 1);
+    endPI.clearQueue();
+    EXPECT_EQ(endPI.heldCount(), 0);
+}
+
 TEST(InfoClass_tests, filterinfo_test)
 {
     // Mostly testing ordering of message sorting and maxTime function arguments
@@ -325,3 +503,183 @@ TEST(InfoClass_tests, inputinfo_test)
     ret_data = subI.getData(0);
     EXPECT_EQ(ret_data->to_string(), "time one");
 }
+
+TEST(InfoClass_tests, metadata_arena_test)
+{
+    helics::MetadataArena arena;
+    helics::InputInfo subI(helics::global_handle(helics::global_federate_id(5),
+                                                 helics::interface_handle(13)),
+                           "key",
+                           "type",
+                           "units",
+                           &arena);
+    helics::PublicationInfo pubI(helics::global_handle(helics::global_federate_id(5),
+                                                       helics::interface_handle(14)),
+                                 "pub",
+                                 "double",
+                                 "MW",
+                                 &arena);
+    for (int ii = 0; ii < 20; ++ii) {
+        helics::global_handle src(helics::global_federate_id(6), helics::interface_handle(ii));
+        subI.addSource(src, "source" + std::to_string(ii), "double", "MW");
+        pubI.subscribers.push_back(src);
+    }
+    EXPECT_EQ(subI.source_info.size(), 20U);
+    EXPECT_EQ(subI.source_info[12].key, "source12");
+    EXPECT_EQ(pubI.subscribers.size(), 20U);
+    EXPECT_EQ(subI.getInjectionUnits(), "MW");
+    EXPECT_GT(arena.allocationCount(), 0U);
+    EXPECT_GT(arena.bytesUsed(), 0U);
+    EXPECT_LE(arena.bytesUsed(), arena.bytesReserved());
+
+    pubI.removeSubscriber(
+        helics::global_handle(helics::global_federate_id(6), helics::interface_handle(3)));
+    EXPECT_EQ(pubI.subscribers.size(), 19U);
+}
+
+/** generate a full vector value in the layout used by the value converters*/
+static std::shared_ptr<const helics::data_block> vectorBlock(const std::vector<double>& vals)
+{
+    const std::uint32_t endianTest{1};
+    std::string data(1 + sizeof(std::uint64_t) + vals.size() * sizeof(double), '\0');
+    std::memcpy(&data[0], &endianTest, 1);
+    const std::uint64_t size{vals.size()};
+    std::memcpy(&data[1], &size, sizeof(size));
+    std::memcpy(&data[1 + sizeof(size)], vals.data(), vals.size() * sizeof(double));
+    return std::make_shared<const helics::data_block>(std::move(data));
+}
+
+TEST(InfoClass_tests, inputinfo_vector_delta_test)
+{
+    helics::InputInfo subI(helics::global_handle(helics::global_federate_id(5),
+                                                 helics::interface_handle(13)),
+                           "key",
+                           "double_vector",
+                           "");
+    helics::global_handle testHandle(helics::global_federate_id(5), helics::interface_handle(45));
+    subI.addSource(testHandle, "", "double_vector", std::string());
+
+    std::vector<double> v1(100, 1.0);
+    std::vector<double> v2 = v1;
+    v2[3] = 4.5;
+    std::vector<double> v3 = v2;
+    v3[97] = -2.0;
+    std::string d1;
+    std::string d2;
+    ASSERT_TRUE(helics::encodeVectorDelta(v1.data(), v1.size(), v2.data(), v2.size(), d1));
+    ASSERT_TRUE(helics::encodeVectorDelta(v2.data(), v2.size(), v3.data(), v3.size(), d2));
+    EXPECT_LT(d1.size(), vectorBlock(v1)->size() / 2);
+    EXPECT_TRUE(helics::isVectorDelta(helics::data_block(d1)));
+    // too many changes or a size change require a full value
+    std::string tooLarge;
+    EXPECT_FALSE(helics::encodeVectorDelta(
+        v1.data(), v1.size(), std::vector<double>(100, 2.0).data(), 100, tooLarge));
+    EXPECT_FALSE(helics::encodeVectorDelta(v1.data(), v1.size(), v1.data(), 50, tooLarge));
+
+    // a delta without a previous value is dropped
+    subI.addData(testHandle, 1.0, 0, std::make_shared<helics::data_block>(d1));
+    EXPECT_FALSE(subI.updateTimeInclusive(1.0));
+
+    // deltas queued before being processed are applied in order
+    subI.addData(testHandle, 2.0, 0, vectorBlock(v1));
+    subI.addData(testHandle, 3.0, 0, std::make_shared<helics::data_block>(d1));
+    subI.addData(testHandle, 4.0, 0, std::make_shared<helics::data_block>(d2));
+    subI.updateTimeInclusive(4.0);
+    EXPECT_EQ(subI.getData(0)->to_string(), vectorBlock(v3)->to_string());
+
+    // deltas which do not match the previous value are dropped
+    subI.addData(testHandle, 5.0, 0, vectorBlock(std::vector<double>(10, 1.0)));
+    subI.addData(testHandle, 6.0, 0, std::make_shared<helics::data_block>(d1));
+    subI.updateTimeInclusive(6.0);
+    EXPECT_EQ(subI.getData(0)->size(), vectorBlock(std::vector<double>(10, 1.0))->size());
+
+    // deltas are not interpreted for other types
+    helics::global_handle strHandle(helics::global_federate_id(5), helics::interface_handle(46));
+    subI.addSource(strHandle, "", "string", std::string());
+    subI.addData(strHandle, 7.0, 0, std::make_shared<helics::data_block>(d1));
+    subI.updateTimeInclusive(7.0);
+    EXPECT_EQ(subI.getData(1)->to_string(), d1);
+}
+
+TEST(InfoClass_tests, ring_buffer_queue_test)
+{
+    helics::RingBufferQueue<int, 4> rq;
+    EXPECT_TRUE(rq.empty());
+    for (int ii = 0; ii < 10; ++ii) {
+        rq.push_back(ii * 2);
+    }
+    EXPECT_EQ(rq.size(), 10U);
+    EXPECT_EQ(rq.overflowSize(), 6U);
+    EXPECT_EQ(rq.front(), 0);
+    EXPECT_EQ(rq.back(), 18);
+
+    // out of order inserts in the ring spill into the overflow
+    rq.insert(std::upper_bound(rq.begin(), rq.end(), 3), 3);
+    rq.insert(std::upper_bound(rq.begin(), rq.end(), 11), 11);
+    rq.insert(rq.end(), 20);
+    EXPECT_EQ(rq.size(), 13U);
+    EXPECT_TRUE(std::is_sorted(rq.begin(), rq.end()));
+    EXPECT_EQ(*std::prev(rq.end()), 20);
+
+    rq.pop_front(2);
+    EXPECT_EQ(rq.front(), 3);
+    EXPECT_EQ(rq.overflowSize(), 7U);
+    // removing more than the ring refills it from the overflow
+    rq.pop_front(5);
+    EXPECT_EQ(rq.front(), 11);
+    EXPECT_EQ(rq.size(), 6U);
+    EXPECT_EQ(rq.overflowSize(), 2U);
+    rq.pop_back();
+    rq.pop_back();
+    EXPECT_EQ(rq.back(), 16);
+    EXPECT_EQ(rq.overflowSize(), 0U);
+    // wrap around the end of the ring
+    rq.pop_front();
+    rq.push_back(22);
+    rq.push_back(24);
+    EXPECT_EQ(rq.overflowSize(), 1U);
+    EXPECT_EQ(rq[3], 22);
+    EXPECT_EQ(rq.back(), 24);
+    rq.pop_front(3);
+    EXPECT_EQ(rq.front(), 22);
+    EXPECT_EQ(rq.size(), 2U);
+    rq.clear();
+    EXPECT_TRUE(rq.empty());
+    EXPECT_EQ(rq.size(), 0U);
+}
+
+TEST(InfoClass_tests, inputinfo_burst_test)
+{
+    helics::InputInfo subI(helics::global_handle(helics::global_federate_id(5),
+                                                 helics::interface_handle(13)),
+                           "key",
+                           "double",
+                           "");
+    helics::global_handle testHandle(helics::global_federate_id(5), helics::interface_handle(45));
+    subI.addSource(testHandle, "", "double", std::string());
+    // enough values to use the overflow of the queue
+    for (int ii = 1; ii <= 100; ++ii) {
+        subI.addData(testHandle,
+                     static_cast<double>(ii),
+                     0,
+                     std::make_shared<helics::data_block>(std::to_string(ii)));
+    }
+    // out of order values land in the correct position
+    subI.addData(testHandle, 5.5, 0, std::make_shared<helics::data_block>("5.5"));
+    subI.addData(testHandle, 60.5, 0, std::make_shared<helics::data_block>("60.5"));
+    EXPECT_EQ(subI.nextValueTime(), 1.0);
+
+    EXPECT_TRUE(subI.updateTimeInclusive(5.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "5");
+    EXPECT_EQ(subI.nextValueTime(), 5.5);
+    EXPECT_TRUE(subI.updateTimeUpTo(6.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "5.5");
+    EXPECT_TRUE(subI.updateTimeInclusive(61.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "61");
+    EXPECT_FALSE(subI.updateTimeInclusive(60.5));
+
+    subI.removeSource(testHandle, 80.0);
+    EXPECT_TRUE(subI.updateTimeInclusive(200.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "80");
+    EXPECT_EQ(subI.nextValueTime(), helics::Time::maxVal());
+}
@@ -0,0 +1,58 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/RoutingTable.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace helics;
+
+TEST(routingTable_tests, federate_routes)
+{
+    RoutingTable table;
+    EXPECT_TRUE(table.empty());
+    global_federate_id fed1(global_federate_id_shift + 3);
+    global_federate_id fed2(global_federate_id_shift + 12);
+    EXPECT_TRUE(table.emplace(fed1, route_id(4)));
+    EXPECT_FALSE(table.emplace(fed1, route_id(5)));
+    EXPECT_TRUE(table.emplace(fed2, route_id(6)));
+    EXPECT_EQ(table.size(), 2U);
+    EXPECT_EQ(table.getRoute(fed1), route_id(4));
+    EXPECT_EQ(table.getRoute(fed2), route_id(6));
+    // unknown federates go to the default route
+    EXPECT_EQ(table.getRoute(global_federate_id(global_federate_id_shift + 7)), parent_route_id);
+    EXPECT_EQ(table.getRoute(global_federate_id(global_federate_id_shift + 7000), route_id(9)),
+              route_id(9));
+    table.setRoute(fed1, route_id(8));
+    EXPECT_EQ(table.getRoute(fed1), route_id(8));
+    table.erase(fed1);
+    EXPECT_FALSE(table.hasRoute(fed1));
+    EXPECT_EQ(table.getRoute(fed1), parent_route_id);
+    EXPECT_EQ(table.size(), 1U);
+}
+
+TEST(routingTable_tests, broker_and_overflow_routes)
+{
+    RoutingTable table;
+    global_federate_id brk(global_broker_id_shift + 2);
+    global_federate_id farFed(global_federate_id_shift + RoutingTable::maxDenseIndex + 10);
+    table.setRoute(brk, route_id(3));
+    table.setRoute(farFed, route_id(5));
+    table.setRoute(direct_core_id, route_id(7));
+    EXPECT_EQ(table.size(), 3U);
+    EXPECT_EQ(table.getRoute(brk), route_id(3));
+    EXPECT_EQ(table.getRoute(farFed), route_id(5));
+    EXPECT_EQ(table.getRoute(direct_core_id), route_id(7));
+    EXPECT_EQ(table.getRoute(global_federate_id(global_broker_id_shift + 1)), parent_route_id);
+
+    table.setRoute(farFed, route_id(11));
+    EXPECT_EQ(table.getRoute(farFed), route_id(11));
+    table.erase(farFed);
+    EXPECT_FALSE(table.hasRoute(farFed));
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.getRoute(brk), parent_route_id);
+}
@@ -0,0 +1,127 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/TimingWheel.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using helics::Time;
+
+TEST(timing_wheel, release_order)
+{
+    helics::TimingWheel<int> wheel(10);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.nextTime(), Time::maxVal());
+    wheel.insert(2.0, 3);
+    wheel.insert(0.5, 1);
+    wheel.insert(2.0, 4);
+    wheel.insert(1.0, 2);
+    wheel.insert(7200.0, 5);
+    EXPECT_EQ(wheel.size(), 5U);
+    EXPECT_EQ(wheel.nextTime(), 0.5);
+
+    std::vector<int> released;
+    auto collect = [&released](Time /*time*/, int value) { released.push_back(value); };
+    wheel.advance(0.25, collect);
+    EXPECT_TRUE(released.empty());
+    wheel.advance(1.0, collect);
+    EXPECT_EQ(released, (std::vector<int>{1, 2}));
+    EXPECT_EQ(wheel.nextTime(), 2.0);
+    wheel.advance(100.0, collect);
+    EXPECT_EQ(released, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(wheel.nextTime(), 7200.0);
+    // an insertion behind the position of the wheel is released on the next advance
+    wheel.insert(50.0, 6);
+    EXPECT_EQ(wheel.nextTime(), 50.0);
+    wheel.advance(Time::maxVal(), collect);
+    EXPECT_EQ(released, (std::vector<int>{1, 2, 3, 4, 6, 5}));
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.nextTime(), Time::maxVal());
+}
+
+TEST(timing_wheel, partial_tick)
+{
+    // a coarse resolution puts all the records in a single tick
+    helics::TimingWheel<int> wheel(40);
+    wheel.insert(3.0, 1);
+    wheel.insert(1.0, 2);
+    wheel.insert(2.0, 3);
+    wheel.insert(1.0, 4);
+    std::vector<int> released;
+    auto collect = [&released](Time /*time*/, int value) { released.push_back(value); };
+    wheel.advance(1.5, collect);
+    EXPECT_EQ(released, (std::vector<int>{2, 4}));
+    EXPECT_EQ(wheel.nextTime(), 2.0);
+    // the records remaining in the tick keep the order they were inserted
+    wheel.advance(3.0, collect);
+    EXPECT_EQ(released, (std::vector<int>{2, 4, 1, 3}));
+}
+
+TEST(timing_wheel, remove)
+{
+    helics::TimingWheel<int> wheel(10);
+    wheel.insert(1.0, 1);
+    wheel.insert(1.0, 2);
+    wheel.insert(3.0, 3);
+    wheel.insert(7200.0, 4);
+    wheel.insert(3.0, 5);
+
+    std::size_t evenCount{0};
+    wheel.forEach([&evenCount](Time /*time*/, int value) {
+        if (value % 2 == 0) {
+            ++evenCount;
+        }
+    });
+    EXPECT_EQ(evenCount, 2U);
+
+    EXPECT_EQ(wheel.removeIf([](Time time, int value) { return value == 1 || time > 100.0; }), 2U);
+    EXPECT_EQ(wheel.size(), 3U);
+    EXPECT_EQ(wheel.nextTime(), 1.0);
+    EXPECT_EQ(wheel.removeIf([](Time time, int /*value*/) { return time < 2.0; }), 1U);
+    EXPECT_EQ(wheel.nextTime(), 3.0);
+    EXPECT_EQ(wheel.removeIf([](Time /*time*/, int value) { return value > 10; }), 0U);
+
+    std::vector<int> released;
+    wheel.advance(10000.0, [&released](Time /*time*/, int value) { released.push_back(value); });
+    EXPECT_EQ(released, (std::vector<int>{3, 5}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(timing_wheel, random_times)
+{
+    helics::TimingWheel<std::pair<Time, int>> wheel;
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<double> dist(0.0, 20000.0);
+    std::vector<Time> times;
+    for (int ii = 0; ii < 20000; ++ii) {
+        Time tm(dist(gen));
+        times.push_back(tm);
+        wheel.insert(tm, {tm, ii});
+    }
+    std::sort(times.begin(), times.end());
+    EXPECT_EQ(wheel.nextTime(), times.front());
+
+    std::vector<Time> released;
+    Time current{0.0};
+    while (!wheel.empty()) {
+        current += 37.5;
+        wheel.advance(current, [&](Time time, std::pair<Time, int> record) {
+            EXPECT_EQ(time, record.first);
+            EXPECT_LE(time, current);
+            released.push_back(time);
+        });
+        EXPECT_GT(wheel.nextTime(), current);
+    }
+    ASSERT_EQ(released.size(), times.size());
+    // within a tick the records are released in insertion order rather than by time
+    std::sort(released.begin(), released.end());
+    EXPECT_EQ(released, times);
+}
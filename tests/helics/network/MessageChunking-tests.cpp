@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionMessage.hpp"
+#include "helics/network/MessageChunking.hpp"
+
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+static helics::ActionMessage largeMessage(std::size_t size)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.source_id = helics::global_federate_id(131072);
+    cmd.actionTime = 2.5;
+    cmd.setStringData("dest", "source", "origsource");
+    cmd.payload.resize(size);
+    for (std::size_t ii = 0; ii < size; ++ii) {
+        cmd.payload[ii] = static_cast<char>(ii % 251);
+    }
+    return cmd;
+}
+
+TEST(MessageChunking, split_and_assemble)
+{
+    auto cmd = largeMessage(10000);
+    auto copy = cmd;
+    auto parts = helics::splitMessage(std::move(cmd), 17, 3000);
+    ASSERT_EQ(parts.size(), 5U);
+    for (const auto& part : parts) {
+        EXPECT_EQ(part.action(), helics::CMD_MESSAGE_CHUNK);
+        EXPECT_EQ(part.messageID, 17);
+        EXPECT_LE(part.payload.size(), 3000U);
+    }
+    helics::MessageAssembler assembler;
+    for (std::size_t ii = 0; ii + 1 < parts.size(); ++ii) {
+        // transmitting the chunks through the serialization
+        helics::ActionMessage received(parts[ii].to_string());
+        EXPECT_FALSE(assembler.addChunk(received));
+    }
+    EXPECT_EQ(assembler.pendingCount(), 1U);
+    helics::ActionMessage last(parts.back().to_string());
+    ASSERT_TRUE(assembler.addChunk(last));
+    EXPECT_EQ(assembler.pendingCount(), 0U);
+    EXPECT_EQ(last.action(), helics::CMD_SEND_MESSAGE);
+    EXPECT_EQ(last.actionTime, copy.actionTime);
+    EXPECT_EQ(last.getString(helics::origSourceStringLoc), "origsource");
+    EXPECT_EQ(last.payload, copy.payload);
+}
+
+TEST(MessageChunking, transmit_queue_interleave)
+{
+    helics::TransmitQueue queue;
+    const helics::route_id bigRoute{3};
+    const helics::route_id otherRoute{4};
+    queue.emplace(bigRoute, helics::ActionMessage(helics::CMD_TIME_REQUEST));
+    queue.emplaceChunked(bigRoute, largeMessage(4000), 1000);
+    queue.emplace(bigRoute, helics::ActionMessage(helics::CMD_TIME_GRANT));
+    for (int ii = 0; ii < 3; ++ii) {
+        helics::ActionMessage ping(helics::CMD_PING);
+        ping.messageID = ii;
+        queue.emplace(otherRoute, ping);
+    }
+
+    std::vector<std::pair<helics::route_id, helics::ActionMessage>> sent;
+    while (auto msg = queue.try_pop()) {
+        sent.push_back(std::move(*msg));
+    }
+    // the time request, the header, 4 chunks, the time grant, and the pings
+    ASSERT_EQ(sent.size(), 10U);
+    EXPECT_EQ(sent[0].second.action(), helics::CMD_TIME_REQUEST);
+    EXPECT_EQ(sent[1].second.action(), helics::CMD_MESSAGE_CHUNK);
+    EXPECT_EQ(sent[1].second.sequenceID, 0U);
+    // the other route alternates with the chunks
+    EXPECT_EQ(sent[2].second.action(), helics::CMD_MESSAGE_CHUNK);
+    EXPECT_TRUE(sent[3].first == otherRoute);
+    EXPECT_EQ(sent[4].second.action(), helics::CMD_MESSAGE_CHUNK);
+    EXPECT_TRUE(sent[5].first == otherRoute);
+
+    // the messages along the route of the large message stay in order
+    std::vector<helics::ActionMessage> bigRouteMessages;
+    helics::MessageAssembler assembler;
+    for (auto& msg : sent) {
+        if (msg.first == bigRoute) {
+            if (msg.second.action() != helics::CMD_MESSAGE_CHUNK ||
+                assembler.addChunk(msg.second)) {
+                bigRouteMessages.push_back(std::move(msg.second));
+            }
+        }
+    }
+    ASSERT_EQ(bigRouteMessages.size(), 3U);
+    EXPECT_EQ(bigRouteMessages[0].action(), helics::CMD_TIME_REQUEST);
+    EXPECT_EQ(bigRouteMessages[1].action(), helics::CMD_SEND_MESSAGE);
+    EXPECT_EQ(bigRouteMessages[1].payload.size(), 4000U);
+    EXPECT_EQ(bigRouteMessages[2].action(), helics::CMD_TIME_GRANT);
+}
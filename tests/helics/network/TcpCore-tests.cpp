@@ -63,6 +63,38 @@ TEST(TcpCore, tcpComms_broker)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(TcpCore, tcpComms_connection_admission)
+{
+    helics::NetworkBrokerData netInfo(helics::interface_type::tcp);
+    netInfo.connectionBatchSize = 2;
+    netInfo.connectionBatchWindow = 20000;
+    netInfo.portNumber = DEFAULT_TCP_BROKER_PORT_NUMBER;
+    helics::tcp::TcpComms comm;
+    comm.loadNetworkInfo(netInfo);
+
+    helics::ActionMessage req(CMD_PROTOCOL);
+    req.messageID = REQUEST_PORTS;
+    req.counter = 2;
+    auto rep1 = comm.generateReplyToIncomingMessage(req);
+    EXPECT_EQ(rep1.messageID, PORT_DEFINITIONS);
+    auto rep2 = comm.generateReplyToIncomingMessage(req);
+    EXPECT_EQ(rep2.messageID, PORT_DEFINITIONS);
+    // the ports for a batch come from a single contiguous block
+    EXPECT_EQ(rep2.getExtraData(), rep1.getExtraData() + 2);
+    // the batch is full so the next connection should be delayed
+    auto rep3 = comm.generateReplyToIncomingMessage(req);
+    EXPECT_EQ(rep3.messageID, DELAY_CONNECTION);
+    EXPECT_GT(rep3.getExtraData(), 0);
+    req.messageID = CONNECTION_REQUEST;
+    auto rep4 = comm.generateReplyToIncomingMessage(req);
+    EXPECT_EQ(rep4.messageID, DELAY_CONNECTION);
+    EXPECT_LE(rep4.getExtraData(), rep3.getExtraData());
+    // once the next window is full deferred connections get pushed to the following one
+    auto rep5 = comm.generateReplyToIncomingMessage(req);
+    EXPECT_EQ(rep5.messageID, DELAY_CONNECTION);
+    EXPECT_GT(rep5.getExtraData(), rep3.getExtraData() + 10000);
+}
+
 TEST(TcpCore, tcpComms_broker_test_transmit)
 {
     std::this_thread::sleep_for(300ms);
@@ -23,6 +23,16 @@ TEST(networkData_tests, basic_test)
     EXPECT_EQ(bdata.portNumber, 45);
 }
 
+TEST(networkData_tests, connection_batch_test)
+{
+    helics::NetworkBrokerData bdata;
+    EXPECT_EQ(bdata.connectionBatchSize, 0);
+    auto parser = bdata.commandLineParser("local");
+    parser->helics_parse("--connection_batch=50 --connection_batch_window=250");
+    EXPECT_EQ(bdata.connectionBatchSize, 50);
+    EXPECT_EQ(bdata.connectionBatchWindow, 250);
+}
+
 TEST(networkData_tests, networkbrokerdata_stripProtocol_test)
 {
     EXPECT_EQ(helics::stripProtocol("tcp://127.0.0.1"), "127.0.0.1");
@@ -2192,6 +2192,45 @@ TEST(evil_value_federate_test, helicsFederatePublishJSON)
     EXPECT_NE(err.error_code, 0);
 }
 
+TEST(evil_value_federate_test, helicsFederatePublishBatch)
+{
+    // void helicsFederatePublishBatch(helics_federate fed, const helics_publication* pubs, const
+    // double* values, int count, helics_error* err);
+    char rdata[256];
+    auto evil_federate = reinterpret_cast<helics_federate>(rdata);
+    char rdata2[256];
+    helics_publication pubs[2] = {reinterpret_cast<helics_publication>(rdata2), nullptr};
+    double vals[2] = {1.0, 2.0};
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    helicsFederatePublishBatch(nullptr, pubs, vals, 2, &err);
+    EXPECT_EQ(err.error_code, 45);
+    helicsErrorClear(&err);
+    helicsFederatePublishBatch(nullptr, pubs, vals, 2, &err);
+    EXPECT_NE(err.error_code, 0);
+    helicsErrorClear(&err);
+    helicsFederatePublishBatch(evil_federate, pubs, vals, 2, &err);
+    EXPECT_NE(err.error_code, 0);
+}
+
+TEST(evil_value_federate_test, helicsFederateGetInputDoubles)
+{
+    // int helicsFederateGetInputDoubles(helics_federate fed, double values[], helics_time
+    // updateTimes[], unsigned char updateMask[], int maxCount, helics_error* err);
+    char rdata[256];
+    auto evil_federate = reinterpret_cast<helics_federate>(rdata);
+    double vals[2];
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    auto res1 = helicsFederateGetInputDoubles(nullptr, vals, nullptr, nullptr, 2, &err);
+    EXPECT_EQ(err.error_code, 45);
+    EXPECT_EQ(res1, 0);
+    helicsErrorClear(&err);
+    auto res2 = helicsFederateGetInputDoubles(evil_federate, vals, nullptr, nullptr, 2, &err);
+    EXPECT_NE(err.error_code, 0);
+    EXPECT_EQ(res2, 0);
+}
+
 TEST(evil_value_federate_test, helicsFederateGetPublicationCount)
 {
     // int helicsFederateGetPublicationCount(helics_federate fed);
@@ -2757,6 +2796,25 @@ TEST(evil_input_test, helicsInputGetVector)
     EXPECT_NE(err.error_code, 0);
 }
 
+TEST(evil_input_test, helicsInputGetVectorView)
+{
+    // const double* helicsInputGetVectorView(helics_input ipt, int* actualSize, helics_error* err);
+    char rdata[256];
+    auto evil_input = reinterpret_cast<helics_input>(rdata);
+    auto err = helicsErrorInitialize();
+    err.error_code = 45;
+    int actLen = -56;
+    auto res1 = helicsInputGetVectorView(nullptr, &actLen, &err);
+    EXPECT_EQ(err.error_code, 45);
+    EXPECT_EQ(res1, nullptr);
+    EXPECT_EQ(actLen, 0);
+    helicsErrorClear(&err);
+    auto res2 = helicsInputGetVectorView(evil_input, &actLen, &err);
+    EXPECT_EQ(res2, nullptr);
+    EXPECT_EQ(actLen, 0);
+    EXPECT_NE(err.error_code, 0);
+}
+
 TEST(evil_input_test, helicsInputGetNamedPoint)
 {
     // void helicsInputGetNamedPoint(helics_input ipt, char* outputString, int maxStringLen, int*
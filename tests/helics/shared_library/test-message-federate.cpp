@@ -219,6 +219,58 @@ TEST_F(mfed_tests, message_object_tests)
     EXPECT_TRUE(helicsMessageCheckFlag(M, 7) == helics_false);
 }
 
+TEST_F(mfed_tests, send_receive_batch)
+{
+    SetupTest(helicsCreateMessageFederate, "test", 1);
+    auto mFed1 = GetFederateAt(0);
+
+    auto epid = helicsFederateRegisterGlobalEndpoint(mFed1, "ep1", nullptr, &err);
+    auto epid2 = helicsFederateRegisterGlobalEndpoint(mFed1, "ep2", nullptr, &err);
+    EXPECT_EQ(err.error_code, helics_ok);
+    CE(helicsEndpointSetDefaultDestination(epid, "ep2", &err));
+    CE(helicsFederateSetTimeProperty(mFed1, helics_property_time_delta, 1.0, &err));
+
+    CE(helicsFederateEnterExecutingMode(mFed1, &err));
+
+    const char* payloads[] = {"a", "bb", "ccc", "dddd"};
+    const void* data[] = {payloads[0], payloads[1], payloads[2], payloads[3]};
+    int lengths[] = {1, 2, 3, 4};
+    // all the messages to the default destination
+    CE(helicsEndpointSendBatch(epid, nullptr, 0, data, lengths, 4, 0.0, &err));
+    const char* dests[] = {"ep1", "ep2"};
+    CE(helicsEndpointSendBatch(epid2, dests, 2, data, lengths, 2, 0.0, &err));
+    helicsEndpointSendBatch(epid2, dests, 2, data, lengths, 3, 0.0, &err);
+    EXPECT_NE(err.error_code, helics_ok);
+    helicsErrorClear(&err);
+    helicsEndpointSendBatch(epid2, dests, 2, nullptr, lengths, 2, 0.0, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+
+    helics_time time;
+    CE(time = helicsFederateRequestTime(mFed1, 1.0, &err));
+    EXPECT_EQ(time, 1.0);
+
+    EXPECT_EQ(helicsEndpointPendingMessages(epid2), 5);
+    helics_message_object messages[10];
+    auto cnt = helicsEndpointReceiveBatch(epid2, messages, 3);
+    ASSERT_EQ(cnt, 3);
+    EXPECT_STREQ(helicsMessageGetString(messages[0]), "a");
+    EXPECT_STREQ(helicsMessageGetString(messages[1]), "bb");
+    EXPECT_STREQ(helicsMessageGetString(messages[2]), "ccc");
+    EXPECT_STREQ(helicsMessageGetSource(messages[2]), "ep1");
+
+    cnt = helicsFederateReceiveBatch(mFed1, messages, 10);
+    ASSERT_EQ(cnt, 3);
+    EXPECT_STREQ(helicsMessageGetDestination(messages[0]), "ep1");
+    EXPECT_STREQ(helicsMessageGetString(messages[0]), "a");
+    EXPECT_STREQ(helicsMessageGetString(messages[1]), "dddd");
+    EXPECT_STREQ(helicsMessageGetString(messages[2]), "bb");
+    EXPECT_STREQ(helicsMessageGetSource(messages[2]), "ep2");
+    EXPECT_EQ(helicsFederateReceiveBatch(mFed1, messages, 10), 0);
+
+    CE(helicsFederateFinalize(mFed1, &err));
+}
+
 TEST_P(mfed_type_tests, send_receive_2fed)
 {
     // extraBrokerArgs = "--loglevel=4";
@@ -512,3 +564,45 @@ TEST(message_object, copy)
     helicsFederateFinalize(fed, nullptr);
     helicsBrokerDisconnect(brk, nullptr);
 }
+
+TEST(message_object, free_reuse)
+{
+    auto brk = helicsCreateBroker("test", "brkpool", "", nullptr);
+
+    auto fi = helicsCreateFederateInfo();
+    helicsFederateInfoSetCoreType(fi, helics_core_type_test, nullptr);
+    auto fed = helicsCreateMessageFederate("fedpool", fi, nullptr);
+    helicsFederateInfoFree(fi);
+
+    auto m1 = helicsFederateCreateMessageObject(fed, nullptr);
+    helicsMessageSetDestination(m1, "dest", nullptr);
+    helicsMessageSetSource(m1, "source", nullptr);
+    helicsMessageSetMessageID(m1, 10, nullptr);
+    helicsMessageSetFlagOption(m1, 4, helics_true, nullptr);
+    helicsMessageSetString(m1, "raw data", nullptr);
+    helicsMessageSetTime(m1, 3.65, nullptr);
+    helicsMessageFree(m1);
+    EXPECT_EQ(helicsMessageIsValid(m1), helics_false);
+
+    // the freed message is reused and comes back empty
+    auto m2 = helicsFederateCreateMessageObject(fed, nullptr);
+    EXPECT_EQ(m2, m1);
+    EXPECT_EQ(helicsMessageIsValid(m2), helics_false);
+    EXPECT_EQ(helicsMessageGetRawDataSize(m2), 0);
+    EXPECT_STREQ(helicsMessageGetSource(m2), "");
+    EXPECT_STREQ(helicsMessageGetDestination(m2), "");
+    EXPECT_EQ(helicsMessageGetMessageID(m2), 0);
+    EXPECT_EQ(helicsMessageCheckFlag(m2, 4), helics_false);
+    EXPECT_DOUBLE_EQ(helicsMessageGetTime(m2), 0.0);
+
+    auto m3 = helicsMessageClone(m2, nullptr);
+    EXPECT_NE(m3, nullptr);
+    // cleared messages are returned to the pool as well
+    helicsFederateClearMessages(fed);
+    auto m4 = helicsFederateCreateMessageObject(fed, nullptr);
+    EXPECT_TRUE(m4 == m2 || m4 == m3);
+
+    helicsFederateEnterExecutingMode(fed, nullptr);
+    helicsFederateFinalize(fed, nullptr);
+    helicsBrokerDisconnect(brk, nullptr);
+}
@@ -405,6 +405,72 @@ TEST_P(vfed_type_tests, single_transfer)
     CE(helicsFederateFinalize(vFed, &err));
 }
 
+TEST_F(vfed_single_tests, publish_batch)
+{
+    SetupTest(helicsCreateValueFederate, "test", 1, 1.0);
+    auto vFed = GetFederateAt(0);
+
+    helics_publication pubs[3];
+    helics_input subs[3];
+    pubs[0] =
+        helicsFederateRegisterGlobalPublication(vFed, "pub1", helics_data_type_double, "", &err);
+    pubs[1] = helicsFederateRegisterGlobalPublication(vFed, "pub2", helics_data_type_int, "", &err);
+    pubs[2] =
+        helicsFederateRegisterGlobalPublication(vFed, "pub3", helics_data_type_string, "", &err);
+    subs[0] = helicsFederateRegisterSubscription(vFed, "pub1", "", &err);
+    subs[1] = helicsFederateRegisterSubscription(vFed, "pub2", "", &err);
+    subs[2] = helicsFederateRegisterSubscription(vFed, "pub3", "", &err);
+    CE(helicsFederateEnterExecutingMode(vFed, &err));
+
+    double vals[3] = {2.5, 7.0, 19.25};
+    CE(helicsFederatePublishBatch(vFed, pubs, vals, 3, &err));
+    CE(helicsFederateRequestTime(vFed, 1.0, &err));
+    EXPECT_EQ(helicsInputGetDouble(subs[0], &err), 2.5);
+    EXPECT_EQ(helicsInputGetInteger(subs[1], &err), 7);
+    EXPECT_EQ(helicsInputGetDouble(subs[2], &err), 19.25);
+
+    CE(helicsFederatePublishBatch(vFed, pubs, vals, 0, &err));
+    helicsFederatePublishBatch(vFed, pubs, nullptr, 3, &err);
+    EXPECT_NE(err.error_code, 0);
+    helicsErrorClear(&err);
+    CE(helicsFederateFinalize(vFed, &err));
+}
+
+TEST_F(vfed_single_tests, get_input_doubles)
+{
+    SetupTest(helicsCreateValueFederate, "test", 1, 1.0);
+    auto vFed = GetFederateAt(0);
+
+    auto pub1 =
+        helicsFederateRegisterGlobalPublication(vFed, "pub1", helics_data_type_double, "", &err);
+    auto pub2 = helicsFederateRegisterGlobalPublication(vFed, "pub2", helics_data_type_int, "", &err);
+    helicsFederateRegisterSubscription(vFed, "pub1", "", &err);
+    helicsFederateRegisterSubscription(vFed, "pub2", "", &err);
+    CE(helicsFederateEnterExecutingMode(vFed, &err));
+
+    double vals[2] = {0.0, 0.0};
+    helics_time times[2] = {0.0, 0.0};
+    unsigned char mask[1] = {0};
+    CE(helicsPublicationPublishDouble(pub1, 4.5, &err));
+    CE(helicsPublicationPublishInteger(pub2, 12, &err));
+    CE(helicsFederateRequestTime(vFed, 1.0, &err));
+    int count{0};
+    CE(count = helicsFederateGetInputDoubles(vFed, vals, times, mask, 2, &err));
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(vals[0], 4.5);
+    EXPECT_EQ(vals[1], 12.0);
+    EXPECT_EQ(times[1], 1.0);
+    EXPECT_EQ(mask[0], 0x03);
+
+    CE(helicsPublicationPublishDouble(pub1, 5.5, &err));
+    CE(helicsFederateRequestTime(vFed, 2.0, &err));
+    CE(count = helicsFederateGetInputDoubles(vFed, vals, nullptr, mask, 2, &err));
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(vals[0], 5.5);
+    EXPECT_EQ(mask[0], 0x01);
+    CE(helicsFederateFinalize(vFed, &err));
+}
+
 // template <class X>
 void runFederateTestDouble(const char* core,
                            double defaultValue,
@@ -778,6 +844,14 @@ void runFederateTestVectorD(const char* core,
         // std::cout << testValue1[i] << "\n";
     }
 
+    // a view of the same value
+    const double* view = nullptr;
+    CE(view = helicsInputGetVectorView(subid, &actualLen, &err));
+    EXPECT_EQ(actualLen, len1);
+    for (int i = 0; i < len1; i++) {
+        EXPECT_EQ(view[i], testValue1[i]);
+    }
+
     // test getting a vector as a string
     actualLen = helicsInputGetStringSize(subid);
     std::string buf;